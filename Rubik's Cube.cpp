@@ -1,21 +1,37 @@
 // Rubik's Cube Solver
 // This program will simulate a Rubik's cube and solve a scrambled cube
-// The Square class (excluding the rotate function), the loadShaders function, and the code for the view and projection matrices were made with help from YouTube tutorials by Suraj Sharma
+// The vertex array setup of the CubeMesh class, the loadShaders function, and the code for the view and projection matrices were made with help from YouTube tutorials by Suraj Sharma
 // All other code belongs to Aryan Kanak
 
 #include <iostream>
 #include <string>
 #include <vector>
+#include <deque>
 #include <sstream>
 #include <fstream>
 #include <algorithm>
 #include <ctime>
+#include <cstring>
+#include <cctype>
+#include <chrono>
+#include <atomic>
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include "glm.hpp"
 #include "gtc/type_ptr.hpp"
 #include "gtc/matrix_transform.hpp"
 
+// use SSSE3 byte shuffles for packed cubes when the compiler targets them
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define PACKED_CUBE_SIMD
+#endif
+
+// use AVX2 for cube batches when the compiler targets it
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 using namespace std;
 
 /*
@@ -47,33 +63,76 @@ using namespace std;
 25 - LDF corner
 */
 
-// declare position of centre of cube
-glm::vec3 position(0.0f, 0.0f, 0.0f);
+// declare colour of each face of a piece, in the order faces are stored in vertices.txt
+const glm::vec4 faceColours[6] =
+{
+    glm::vec4(1.0, 1.0, 1.0, 1.0),
+    glm::vec4(1.0, 1.0, 0.0, 1.0),
+    glm::vec4(1.0, 0.5, 0.0, 1.0),
+    glm::vec4(1.0, 0.0, 0.0, 1.0),
+    glm::vec4(0.0, 1.0, 0.0, 1.0),
+    glm::vec4(0.0, 0.0, 1.0, 1.0)
+};
+
+// declare colour of faces inside the cube
+const glm::vec4 bodyColour(0.0, 0.0, 0.0, 1.0);
+
+// declare binding point of the uniform block that holds the model matrix of each piece
+const GLuint PIECE_BLOCK_BINDING = 0;
+
+// shader uniforms structure
+// locations are looked up once after the shaders are linked instead of on every draw
+struct ShaderUniforms
+{
+    GLint viewProj;
+    GLint turnAxis;
+    GLint turnMask;
+    GLint turnAngle;
+};
+
+// cube vertex structure
+struct CubeVertex
+{
+    glm::vec3 position;
+    glm::vec4 colour;
+    glm::vec2 uv;
+    GLint piece;
+};
 
-// square class
-class Square
+// cube mesh class
+// holds every piece of a cube in one buffer, with each vertex knowing its piece so that pieces can be rotated separately
+// stickers come first in the index buffer, followed by the faces inside the cube that can only be seen part way through a turn
+class CubeMesh
 {
 private:
     // declare variables
-    vector <glm::vec3> vertices;
-    GLuint indices[6] =
-    {
-        0, 1, 2,
-        0, 2, 3
-    };
     GLuint vertexArrayObject;
     GLuint vertexBuffer;
     GLuint indexBuffer;
-    glm::mat4 modelMatrix;
+    GLuint pieceBuffer;
+    int pieceCount;
+    int stickerIndexCount;
+    int indexCount;
 
-    // intialize vertex data
-    void initVertexData(vector <glm::vec3>& vertexArray)
+    // add a square to vertices and indices
+    void addSquare(vector <CubeVertex>& vertices, vector <GLuint>& indices, const vector <glm::vec3>& square, glm::vec4 colour, int piece)
     {
-        vertices = vertexArray;
+        // two triangles for each square, with coordinates across the square that the fragment shader draws its border from
+        GLuint squareIndices[6] = { 0, 1, 2, 0, 2, 3 };
+        glm::vec2 squareUVs[4] = { glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 0.0f), glm::vec2(1.0f, 1.0f), glm::vec2(0.0f, 1.0f) };
+        for (int i = 0; i < 6; i++)
+        {
+            indices.push_back(vertices.size() + squareIndices[i]);
+        }
+        for (int i = 0; i < 4; i++)
+        {
+            CubeVertex vertex = { square[i], colour, squareUVs[i], piece };
+            vertices.push_back(vertex);
+        }
     }
 
     // intialize vertex array object
-    void initVertexArrayObject()
+    void initVertexArrayObject(const vector <CubeVertex>& vertices, const vector <GLuint>& indices)
     {
         // create and bind vertex array object
         glGenVertexArrays(1, &this->vertexArrayObject);
@@ -82,137 +141,107 @@ private:
         // create and bind vertex buffer
         glGenBuffers(1, &this->vertexBuffer);
         glBindBuffer(GL_ARRAY_BUFFER, this->vertexBuffer);
-        glBufferData(GL_ARRAY_BUFFER, 4 * sizeof(glm::vec3), this->vertices.data(), GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(CubeVertex), vertices.data(), GL_STATIC_DRAW);
+
+        // vertex attribute pointers
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(CubeVertex), (GLvoid*)offsetof(CubeVertex, position));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(CubeVertex), (GLvoid*)offsetof(CubeVertex, colour));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(CubeVertex), (GLvoid*)offsetof(CubeVertex, uv));
+        glEnableVertexAttribArray(2);
+        glVertexAttribIPointer(3, 1, GL_INT, sizeof(CubeVertex), (GLvoid*)offsetof(CubeVertex, piece));
+        glEnableVertexAttribArray(3);
 
         // create and bind index buffer
         glGenBuffers(1, &this->indexBuffer);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->indexBuffer);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * sizeof(GLuint), this->indices, GL_STATIC_DRAW);
-
-        // vertex attribute pointers
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (GLvoid*)0);
-        glEnableVertexAttribArray(0);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
 
         // unbind vertex array object
         glBindVertexArray(0);
-    }
-
-    // initialize model matrix
-    void initModelMatrix()
-    {
-        this->modelMatrix = glm::mat4(1.0f);
-    }
-
-    // translate square
-    void translate()
-    {
-        this->modelMatrix = glm::translate(this->modelMatrix, position);
-    }
 
-    // update uniforms
-    void updateUniforms(GLuint core_program, glm::mat4 projMatrix, glm::mat4 viewMatrix, glm::vec4 colour)
-    {
-        glm::mat4 mvp = projMatrix * viewMatrix * this->modelMatrix;
-        glUniformMatrix4fv(glGetUniformLocation(core_program, "mvp"), 1, GL_FALSE, glm::value_ptr(mvp));
-        glUniform4f(glGetUniformLocation(core_program, "colour"), colour.x, colour.y, colour.z, colour.w);
-    }
-
-    // rotate square
-    void rotate(glm::mat4 rotation)
-    {
-        this->modelMatrix = this->modelMatrix * rotation;
+        // create uniform buffer for model matrices, an array of mat4 has the same layout in std140 as it does in memory
+        glGenBuffers(1, &this->pieceBuffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, this->pieceBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, this->pieceCount * sizeof(glm::mat4), NULL, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, PIECE_BLOCK_BINDING, this->pieceBuffer);
     }
 public:
-    // initialize variables
-    void init(vector <glm::vec3> vertexArray)
+    // constructor to build mesh from the squares of every piece, in the order pieces are numbered
+    CubeMesh(const vector < vector <glm::vec3> >* pieceVertices, int pieceCount)
     {
-        this->initVertexData(vertexArray);
-        this->initVertexArrayObject();
-        this->initModelMatrix();
+        vector <CubeVertex> vertices;
+        vector <GLuint> indices;
+        for (int body = 0; body < 2; body++)
+        {
+            for (int i = 0; i < pieceCount; i++)
+            {
+                // find centre of piece
+                glm::vec3 centre(0.0f, 0.0f, 0.0f);
+                for (int j = 0; j < 6; j++)
+                {
+                    for (int k = 0; k < 4; k++)
+                    {
+                        centre = centre + pieceVertices[i][j][k] * (1.0f / 24.0f);
+                    }
+                }
+                // a square faces out of the cube when it is on the same side of its piece as the piece is of the cube
+                for (int j = 0; j < 6; j++)
+                {
+                    glm::vec3 squareCentre = (pieceVertices[i][j][0] + pieceVertices[i][j][2]) * 0.5f;
+                    glm::vec3 normal = squareCentre - centre;
+                    bool outside = normal.x * centre.x + normal.y * centre.y + normal.z * centre.z > 0.0001f;
+                    if (outside && body == 0)
+                    {
+                        addSquare(vertices, indices, pieceVertices[i][j], faceColours[j], i);
+                    }
+                    else if (!outside && body == 1)
+                    {
+                        addSquare(vertices, indices, pieceVertices[i][j], bodyColour, i);
+                    }
+                }
+            }
+            if (body == 0)
+            {
+                this->stickerIndexCount = indices.size();
+            }
+        }
+        this->pieceCount = pieceCount;
+        this->indexCount = indices.size();
+        this->initVertexArrayObject(vertices, indices);
     }
 
-    // destroy square
-    void destroy()
+    // destructor to delete vertex array object and buffers
+    ~CubeMesh()
     {
         glDeleteVertexArrays(1, &this->vertexArrayObject);
         glDeleteBuffers(1, &this->vertexBuffer);
         glDeleteBuffers(1, &this->indexBuffer);
+        glDeleteBuffers(1, &this->pieceBuffer);
     }
 
-    // render square
-    void render(GLuint core_program, glm::mat4 projMatrix, glm::mat4 viewMatrix, glm::vec4 colour, glm::mat4 rotation)
-    {
-        this->initModelMatrix();
-        this->rotate(rotation);
-        this->translate();
-        this->updateUniforms(core_program, projMatrix, viewMatrix, colour);
-
-        glBindVertexArray(vertexArrayObject);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-    }
-};
-
-// cube class
-class Cube
-{
-private:
-    // declare variables
-    Square UFace;
-    Square DFace;
-    Square LFace;
-    Square RFace;
-    Square FFace;
-    Square BFace;
-public:
-    // constructor to initialize all variables
-    Cube(vector < vector <glm::vec3> > vertexArray)
-    {
-        UFace.init(vertexArray[0]);
-        DFace.init(vertexArray[1]);
-        LFace.init(vertexArray[2]);
-        RFace.init(vertexArray[3]);
-        FFace.init(vertexArray[4]);
-        BFace.init(vertexArray[5]);
-    }
-
-    // destructor to delete vertex array objects and buffers in variables
-    ~Cube()
+    // upload the model matrix of each piece
+    void upload(const ShaderUniforms& uniforms, const glm::mat4& viewProjMatrix, const glm::mat4* models)
     {
-        UFace.destroy();
-        DFace.destroy();
-        LFace.destroy();
-        RFace.destroy();
-        FFace.destroy();
-        BFace.destroy();
+        glUniformMatrix4fv(uniforms.viewProj, 1, GL_FALSE, glm::value_ptr(viewProjMatrix));
+        glBindBuffer(GL_UNIFORM_BUFFER, this->pieceBuffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, this->pieceCount * sizeof(glm::mat4), models);
     }
 
-    // render cube
-    void render(GLuint core_program, glm::mat4 projMatrix, glm::mat4 viewMatrix, glm::mat4 rotation)
+    // draw cube, inside faces are only needed while a layer is part way through a turn
+    void draw(bool drawBody)
     {
-        UFace.render(core_program, projMatrix, viewMatrix, glm::vec4(1.0, 1.0, 1.0, 1.0), rotation);
-        DFace.render(core_program, projMatrix, viewMatrix, glm::vec4(1.0, 1.0, 0.0, 1.0), rotation);
-        LFace.render(core_program, projMatrix, viewMatrix, glm::vec4(1.0, 0.5, 0.0, 1.0), rotation);
-        RFace.render(core_program, projMatrix, viewMatrix, glm::vec4(1.0, 0.0, 0.0, 1.0), rotation);
-        FFace.render(core_program, projMatrix, viewMatrix, glm::vec4(0.0, 1.0, 0.0, 1.0), rotation);
-        BFace.render(core_program, projMatrix, viewMatrix, glm::vec4(0.0, 0.0, 1.0, 1.0), rotation);
+        glBindVertexArray(vertexArrayObject);
+        glDrawElements(GL_TRIANGLES, drawBody ? this->indexCount : this->stickerIndexCount, GL_UNSIGNED_INT, 0);
     }
 };
 
-// pause program
-void delay(double delayLength)
-{
-    glfwSetTime(0.0);
-    while (glfwGetTime() < delayLength)
-    {
-
-    }
-}
-
 // swap four pieces
-void swapPieces(int& piece1, int& piece2, int& piece3, int& piece4)
+void swapPieces(unsigned char& piece1, unsigned char& piece2, unsigned char& piece3, unsigned char& piece4)
 {
     // swap pieces
-    int swapper = piece4;
+    unsigned char swapper = piece4;
     piece4 = piece3;
     piece3 = piece2;
     piece2 = piece1;
@@ -279,3261 +308,4856 @@ glm::mat4 ZAxisRotation(glm::mat4 rotation, float angle)
     return rotation;
 }
 
-// render cubes
-void renderCubes(GLFWwindow* window, Cube* cubes, GLuint core_program, glm::mat4 proj, glm::mat4 view, glm::mat4(&rotation)[26])
+// cube observer class
+// an observer is told about every turn made on a cube state so that it can follow the turn
+class CubeObserver
 {
-    // clear
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-    // render outline of cubes
-    glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    for (int i = 0; i < 26; i++)
-    {
-        cubes[i].render(core_program, proj, view, rotation[i]);
-    }
-    // render cubes
-    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-    for (int i = 0; i < 26; i++)
-    {
-        cubes[i].render(core_program, proj, view, rotation[i]);
-    }
-    // swap buffers
-    glfwSwapBuffers(window);
-}
-
-// turn U face
-void turnUFace(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // U move
-    if (degree == 1)
-    {
-        // transform cube
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], 90.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], 90.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], 90.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], 90.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], 90.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], 90.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], 90.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], 90.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], 90.0);
-        rotation[pieces[0]] = ZAxisRotation(rotation[pieces[0]], 22.0);
-        rotation[pieces[7]] = ZAxisRotation(rotation[pieces[7]], 22.0);
-        rotation[pieces[15]] = ZAxisRotation(rotation[pieces[15]], 22.0);
-        rotation[pieces[6]] = ZAxisRotation(rotation[pieces[6]], 22.0);
-        rotation[pieces[14]] = ZAxisRotation(rotation[pieces[14]], 22.0);
-        rotation[pieces[18]] = ZAxisRotation(rotation[pieces[18]], 22.0);
-        rotation[pieces[19]] = ZAxisRotation(rotation[pieces[19]], 22.0);
-        rotation[pieces[20]] = ZAxisRotation(rotation[pieces[20]], 22.0);
-        rotation[pieces[21]] = ZAxisRotation(rotation[pieces[21]], 22.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[7], pieces[15], pieces[6], pieces[14]);
-        swapPieces(pieces[18], pieces[19], pieces[20], pieces[21]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[0], edgeStickers[1], edgeStickers[2], edgeStickers[3]);
-        swapPieces(edgeStickers[16], edgeStickers[12], edgeStickers[8], edgeStickers[4]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[0], cornerStickers[1], cornerStickers[2], cornerStickers[3]);
-        swapPieces(cornerStickers[16], cornerStickers[12], cornerStickers[8], cornerStickers[4]);
-        swapPieces(cornerStickers[17], cornerStickers[13], cornerStickers[9], cornerStickers[5]);
-    }
-    // U2 move
-    else if (degree == 2)
-    {
-        // transform cube
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], 180.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], 180.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], 180.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], 180.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], 180.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], 180.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], 180.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], 180.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], 180.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -44.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -44.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -44.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -44.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -44.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -44.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -44.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -44.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -44.0);
-        // save new positions of pieces
-        swap(pieces[7], pieces[6]);
-        swap(pieces[15], pieces[14]);
-        swap(pieces[18], pieces[20]);
-        swap(pieces[19], pieces[21]);
-        // save new positions of edge stickers
-        swap(edgeStickers[0], edgeStickers[2]);
-        swap(edgeStickers[1], edgeStickers[3]);
-        swap(edgeStickers[16], edgeStickers[8]);
-        swap(edgeStickers[12], edgeStickers[4]);
-        // save new positions of corner stickers
-        swap(cornerStickers[0], cornerStickers[2]);
-        swap(cornerStickers[1], cornerStickers[3]);
-        swap(cornerStickers[16], cornerStickers[8]);
-        swap(cornerStickers[12], cornerStickers[4]);
-        swap(cornerStickers[17], cornerStickers[9]);
-        swap(cornerStickers[13], cornerStickers[5]);
-    }
-    // U' move
-    else if (degree == 3)
-    {
-        // transform cube
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], -90.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], -90.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], -90.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], -90.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], -90.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], -90.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], -90.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], -90.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], -90.0);
-        rotation[pieces[0]] = ZAxisRotation(rotation[pieces[0]], -22.0);
-        rotation[pieces[7]] = ZAxisRotation(rotation[pieces[7]], -22.0);
-        rotation[pieces[15]] = ZAxisRotation(rotation[pieces[15]], -22.0);
-        rotation[pieces[6]] = ZAxisRotation(rotation[pieces[6]], -22.0);
-        rotation[pieces[14]] = ZAxisRotation(rotation[pieces[14]], -22.0);
-        rotation[pieces[18]] = ZAxisRotation(rotation[pieces[18]], -22.0);
-        rotation[pieces[19]] = ZAxisRotation(rotation[pieces[19]], -22.0);
-        rotation[pieces[20]] = ZAxisRotation(rotation[pieces[20]], -22.0);
-        rotation[pieces[21]] = ZAxisRotation(rotation[pieces[21]], -22.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[7], pieces[14], pieces[6], pieces[15]);
-        swapPieces(pieces[18], pieces[21], pieces[20], pieces[19]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[0], edgeStickers[3], edgeStickers[2], edgeStickers[1]);
-        swapPieces(edgeStickers[16], edgeStickers[4], edgeStickers[8], edgeStickers[12]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[0], cornerStickers[3], cornerStickers[2], cornerStickers[1]);
-        swapPieces(cornerStickers[16], cornerStickers[4], cornerStickers[8], cornerStickers[12]);
-        swapPieces(cornerStickers[17], cornerStickers[5], cornerStickers[9], cornerStickers[13]);
-    }
-}
-
-// turn D face
-void turnDFace(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // D move
-    if (degree == 1)
-    {
-        // transform cube
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], -90.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], -90.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], -90.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], -90.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], -90.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], -90.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], -90.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], -90.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], -90.0);
-        rotation[pieces[5]] = ZAxisRotation(rotation[pieces[5]], -22.0);
-        rotation[pieces[8]] = ZAxisRotation(rotation[pieces[8]], -22.0);
-        rotation[pieces[16]] = ZAxisRotation(rotation[pieces[16]], -22.0);
-        rotation[pieces[9]] = ZAxisRotation(rotation[pieces[9]], -22.0);
-        rotation[pieces[17]] = ZAxisRotation(rotation[pieces[17]], -22.0);
-        rotation[pieces[22]] = ZAxisRotation(rotation[pieces[22]], -22.0);
-        rotation[pieces[23]] = ZAxisRotation(rotation[pieces[23]], -22.0);
-        rotation[pieces[24]] = ZAxisRotation(rotation[pieces[24]], -22.0);
-        rotation[pieces[25]] = ZAxisRotation(rotation[pieces[25]], -22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[9], pieces[16], pieces[8], pieces[17]);
-        swapPieces(pieces[24], pieces[23], pieces[22], pieces[25]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[20], edgeStickers[21], edgeStickers[22], edgeStickers[23]);
-        swapPieces(edgeStickers[6], edgeStickers[10], edgeStickers[14], edgeStickers[18]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[20], cornerStickers[21], cornerStickers[22], cornerStickers[23]);
-        swapPieces(cornerStickers[6], cornerStickers[10], cornerStickers[14], cornerStickers[18]);
-        swapPieces(cornerStickers[7], cornerStickers[11], cornerStickers[15], cornerStickers[19]);
-    }
-    // D2 move
-    else if (degree == 2)
-    {
-        // transform cube
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], 180.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], 180.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], 180.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], 180.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], 180.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], 180.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], 180.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], 180.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], 180.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -44.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -44.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -44.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -44.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -44.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -44.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -44.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -44.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -44.0);
-        // save new positions of pieces
-        swap(pieces[8], pieces[9]);
-        swap(pieces[16], pieces[17]);
-        swap(pieces[22], pieces[24]);
-        swap(pieces[23], pieces[25]);
-        // save new positions of edge stickers
-        swap(edgeStickers[20], edgeStickers[22]);
-        swap(edgeStickers[21], edgeStickers[23]);
-        swap(edgeStickers[6], edgeStickers[14]);
-        swap(edgeStickers[10], edgeStickers[18]);
-        // save new positions of corner stickers
-        swap(cornerStickers[20], cornerStickers[22]);
-        swap(cornerStickers[21], cornerStickers[23]);
-        swap(cornerStickers[6], cornerStickers[14]);
-        swap(cornerStickers[10], cornerStickers[18]);
-        swap(cornerStickers[7], cornerStickers[15]);
-        swap(cornerStickers[11], cornerStickers[19]);
-    }
-    // D' move
-    else if (degree == 3)
-    {
-        // transform cube
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], 90.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], 90.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], 90.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], 90.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], 90.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], 90.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], 90.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], 90.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], 90.0);
-        rotation[pieces[5]] = ZAxisRotation(rotation[pieces[5]], 22.0);
-        rotation[pieces[8]] = ZAxisRotation(rotation[pieces[8]], 22.0);
-        rotation[pieces[16]] = ZAxisRotation(rotation[pieces[16]], 22.0);
-        rotation[pieces[9]] = ZAxisRotation(rotation[pieces[9]], 22.0);
-        rotation[pieces[17]] = ZAxisRotation(rotation[pieces[17]], 22.0);
-        rotation[pieces[22]] = ZAxisRotation(rotation[pieces[22]], 22.0);
-        rotation[pieces[23]] = ZAxisRotation(rotation[pieces[23]], 22.0);
-        rotation[pieces[24]] = ZAxisRotation(rotation[pieces[24]], 22.0);
-        rotation[pieces[25]] = ZAxisRotation(rotation[pieces[25]], 22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[8], pieces[16], pieces[9], pieces[17]);
-        swapPieces(pieces[22], pieces[23], pieces[24], pieces[25]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[20], edgeStickers[23], edgeStickers[22], edgeStickers[21]);
-        swapPieces(edgeStickers[6], edgeStickers[18], edgeStickers[14], edgeStickers[10]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[20], cornerStickers[23], cornerStickers[22], cornerStickers[21]);
-        swapPieces(cornerStickers[6], cornerStickers[18], cornerStickers[14], cornerStickers[10]);
-        swapPieces(cornerStickers[7], cornerStickers[19], cornerStickers[15], cornerStickers[11]);
-    }
-}
-
-// turn L face
-void turnLFace(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // L move
-    if (degree == 1)
-    {
-        // transform cube
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], 22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], 22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], 22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], 22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], 22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], 22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], 22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], 22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], 22.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], -32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], -32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], -32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], -32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], -32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], -32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], -32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], -32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], -32.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -90.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -90.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -90.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -90.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -90.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -90.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -90.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -90.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -90.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], 32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], 32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], 32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], 32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], 32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], 32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], 32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], 32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], 32.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[14], pieces[10], pieces[17], pieces[13]);
-        swapPieces(pieces[21], pieces[25], pieces[22], pieces[18]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[3], edgeStickers[11], edgeStickers[23], edgeStickers[17]);
-        swapPieces(edgeStickers[4], edgeStickers[5], edgeStickers[6], edgeStickers[7]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[3], cornerStickers[11], cornerStickers[23], cornerStickers[17]);
-        swapPieces(cornerStickers[4], cornerStickers[5], cornerStickers[6], cornerStickers[7]);
-        swapPieces(cornerStickers[0], cornerStickers[8], cornerStickers[20], cornerStickers[18]);
-    }
-    // L2 move
-    else if (degree == 2)
-    {
-        // transform cube
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], 22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], 22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], 22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], 22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], 22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], 22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], 22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], 22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], 22.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], -32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], -32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], -32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], -32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], -32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], -32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], -32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], -32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], -32.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], 180.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], 180.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], 180.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], 180.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], 180.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], 180.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], 180.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], 180.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], 180.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], 32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], 32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], 32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], 32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], 32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], 32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], 32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], 32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], 32.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -22.0);
-        // save new positions of pieces
-        swap(pieces[14], pieces[17]);
-        swap(pieces[10], pieces[13]);
-        swap(pieces[21], pieces[22]);
-        swap(pieces[25], pieces[18]);
-        // save new positions of edge stickers
-        swap(edgeStickers[3], edgeStickers[23]);
-        swap(edgeStickers[11], edgeStickers[17]);
-        swap(edgeStickers[4], edgeStickers[6]);
-        swap(edgeStickers[5], edgeStickers[7]);
-        // save new positions of corner stickers
-        swap(cornerStickers[3], cornerStickers[23]);
-        swap(cornerStickers[11], cornerStickers[17]);
-        swap(cornerStickers[4], cornerStickers[6]);
-        swap(cornerStickers[5], cornerStickers[7]);
-        swap(cornerStickers[0], cornerStickers[20]);
-        swap(cornerStickers[8], cornerStickers[18]);
-    }
-    // L' move
-    else if (degree == 3)
-    {
-        // transform cube
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], 22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], 22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], 22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], 22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], 22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], 22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], 22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], 22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], 22.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], -32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], -32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], -32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], -32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], -32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], -32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], -32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], -32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], -32.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], 90.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], 90.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], 90.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], 90.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], 90.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], 90.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], 90.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], 90.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], 90.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], 32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], 32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], 32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], 32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], 32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], 32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], 32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], 32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], 32.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[14], pieces[13], pieces[17], pieces[10]);
-        swapPieces(pieces[21], pieces[18], pieces[22], pieces[25]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[3], edgeStickers[17], edgeStickers[23], edgeStickers[11]);
-        swapPieces(edgeStickers[4], edgeStickers[7], edgeStickers[6], edgeStickers[5]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[3], cornerStickers[17], cornerStickers[23], cornerStickers[11]);
-        swapPieces(cornerStickers[4], cornerStickers[7], cornerStickers[6], cornerStickers[5]);
-        swapPieces(cornerStickers[0], cornerStickers[18], cornerStickers[20], cornerStickers[8]);
-    }
-}
-
-// turn R face
-void turnRFace(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // R move
-    if (degree == 1)
-    {
-        // transform cube
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], 22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], 22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], 22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], 22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], 22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], 22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], 22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], 22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], 22.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], -32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], -32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], -32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], -32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], -32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], -32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], -32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], -32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], -32.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], 90.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], 90.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], 90.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], 90.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], 90.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], 90.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], 90.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], 90.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], 90.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], 32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], 32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], 32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], 32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], 32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], 32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], 32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], 32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], 32.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[15], pieces[12], pieces[16], pieces[11]);
-        swapPieces(pieces[20], pieces[19], pieces[23], pieces[24]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[1], edgeStickers[19], edgeStickers[21], edgeStickers[9]);
-        swapPieces(edgeStickers[12], edgeStickers[13], edgeStickers[14], edgeStickers[15]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[1], cornerStickers[19], cornerStickers[21], cornerStickers[9]);
-        swapPieces(cornerStickers[12], cornerStickers[13], cornerStickers[14], cornerStickers[15]);
-        swapPieces(cornerStickers[2], cornerStickers[16], cornerStickers[22], cornerStickers[10]);
-    }
-    // R2 move
-    else if (degree == 2)
-    {
-        // transform cube
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], 22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], 22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], 22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], 22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], 22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], 22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], 22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], 22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], 22.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], -32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], -32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], -32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], -32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], -32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], -32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], -32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], -32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], -32.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], 180.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], 180.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], 180.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], 180.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], 180.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], 180.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], 180.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], 180.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], 180.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], 32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], 32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], 32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], 32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], 32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], 32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], 32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], 32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], 32.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -22.0);
-        // save new positions of pieces
-        swap(pieces[15], pieces[16]);
-        swap(pieces[12], pieces[11]);
-        swap(pieces[20], pieces[23]);
-        swap(pieces[19], pieces[24]);
-        // save new positions of edge stickers
-        swap(edgeStickers[1], edgeStickers[21]);
-        swap(edgeStickers[19], edgeStickers[9]);
-        swap(edgeStickers[12], edgeStickers[14]);
-        swap(edgeStickers[13], edgeStickers[15]);
-        // save new positions of corner stickers
-        swap(cornerStickers[1], cornerStickers[21]);
-        swap(cornerStickers[19], cornerStickers[9]);
-        swap(cornerStickers[12], cornerStickers[14]);
-        swap(cornerStickers[13], cornerStickers[15]);
-        swap(cornerStickers[2], cornerStickers[22]);
-        swap(cornerStickers[16], cornerStickers[10]);
-    }
-    // R' move
-    else if (degree == 3)
-    {
-        // transform cube
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], 22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], 22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], 22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], 22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], 22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], 22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], 22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], 22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], 22.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], -32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], -32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], -32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], -32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], -32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], -32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], -32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], -32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], -32.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -90.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -90.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -90.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -90.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -90.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -90.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -90.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -90.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -90.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], 32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], 32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], 32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], 32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], 32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], 32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], 32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], 32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], 32.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[15], pieces[11], pieces[16], pieces[12]);
-        swapPieces(pieces[20], pieces[24], pieces[23], pieces[19]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[1], edgeStickers[9], edgeStickers[21], edgeStickers[19]);
-        swapPieces(edgeStickers[12], edgeStickers[15], edgeStickers[14], edgeStickers[13]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[1], cornerStickers[9], cornerStickers[21], cornerStickers[19]);
-        swapPieces(cornerStickers[12], cornerStickers[15], cornerStickers[14], cornerStickers[13]);
-        swapPieces(cornerStickers[2], cornerStickers[10], cornerStickers[22], cornerStickers[16]);
-    }
-}
-
-// turn F face
-void turnFFace(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // F move
-    if (degree == 1)
-    {
-        // transform cube
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], 22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], 22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], 22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], 22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], 22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], 22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], 22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], 22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], 22.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], -32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], -32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], -32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], -32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], -32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], -32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], -32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], -32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], -32.0);
-        rotation[pieces[2]] = ZAxisRotation(rotation[pieces[2]], 90.0);
-        rotation[pieces[6]] = ZAxisRotation(rotation[pieces[6]], 90.0);
-        rotation[pieces[11]] = ZAxisRotation(rotation[pieces[11]], 90.0);
-        rotation[pieces[9]] = ZAxisRotation(rotation[pieces[9]], 90.0);
-        rotation[pieces[10]] = ZAxisRotation(rotation[pieces[10]], 90.0);
-        rotation[pieces[20]] = ZAxisRotation(rotation[pieces[20]], 90.0);
-        rotation[pieces[24]] = ZAxisRotation(rotation[pieces[24]], 90.0);
-        rotation[pieces[25]] = ZAxisRotation(rotation[pieces[25]], 90.0);
-        rotation[pieces[21]] = ZAxisRotation(rotation[pieces[21]], 90.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], 32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], 32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], 32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], 32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], 32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], 32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], 32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], 32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], 32.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[6], pieces[11], pieces[9], pieces[10]);
-        swapPieces(pieces[20], pieces[24], pieces[25], pieces[21]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[8], edgeStickers[9], edgeStickers[10], edgeStickers[11]);
-        swapPieces(edgeStickers[2], edgeStickers[15], edgeStickers[20], edgeStickers[5]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[8], cornerStickers[9], cornerStickers[10], cornerStickers[11]);
-        swapPieces(cornerStickers[2], cornerStickers[15], cornerStickers[20], cornerStickers[5]);
-        swapPieces(cornerStickers[3], cornerStickers[12], cornerStickers[21], cornerStickers[6]);
-    }
-    // F2 move
-    else if (degree == 2)
-    {
-        // transform cube
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], 22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], 22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], 22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], 22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], 22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], 22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], 22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], 22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], 22.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], -32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], -32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], -32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], -32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], -32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], -32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], -32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], -32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], -32.0);
-        rotation[pieces[2]] = ZAxisRotation(rotation[pieces[2]], 180.0);
-        rotation[pieces[6]] = ZAxisRotation(rotation[pieces[6]], 180.0);
-        rotation[pieces[11]] = ZAxisRotation(rotation[pieces[11]], 180.0);
-        rotation[pieces[9]] = ZAxisRotation(rotation[pieces[9]], 180.0);
-        rotation[pieces[10]] = ZAxisRotation(rotation[pieces[10]], 180.0);
-        rotation[pieces[20]] = ZAxisRotation(rotation[pieces[20]], 180.0);
-        rotation[pieces[24]] = ZAxisRotation(rotation[pieces[24]], 180.0);
-        rotation[pieces[25]] = ZAxisRotation(rotation[pieces[25]], 180.0);
-        rotation[pieces[21]] = ZAxisRotation(rotation[pieces[21]], 180.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], 32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], 32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], 32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], 32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], 32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], 32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], 32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], 32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], 32.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -22.0);
-        // save new positions of pieces
-        swap(pieces[6], pieces[9]);
-        swap(pieces[11], pieces[10]);
-        swap(pieces[20], pieces[25]);
-        swap(pieces[24], pieces[21]);
-        // save new positions of edge stickers
-        swap(edgeStickers[8], edgeStickers[10]);
-        swap(edgeStickers[9], edgeStickers[11]);
-        swap(edgeStickers[2], edgeStickers[20]);
-        swap(edgeStickers[15], edgeStickers[5]);
-        // save new positions of corner stickers
-        swap(cornerStickers[8], cornerStickers[10]);
-        swap(cornerStickers[9], cornerStickers[11]);
-        swap(cornerStickers[2], cornerStickers[20]);
-        swap(cornerStickers[15], cornerStickers[5]);
-        swap(cornerStickers[3], cornerStickers[21]);
-        swap(cornerStickers[12], cornerStickers[6]);
-    }
-    // F' move
-    else if (degree == 3)
-    {
-        // transform cube
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], 22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], 22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], 22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], 22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], 22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], 22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], 22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], 22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], 22.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], -32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], -32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], -32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], -32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], -32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], -32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], -32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], -32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], -32.0);
-        rotation[pieces[2]] = ZAxisRotation(rotation[pieces[2]], -90.0);
-        rotation[pieces[6]] = ZAxisRotation(rotation[pieces[6]], -90.0);
-        rotation[pieces[11]] = ZAxisRotation(rotation[pieces[11]], -90.0);
-        rotation[pieces[9]] = ZAxisRotation(rotation[pieces[9]], -90.0);
-        rotation[pieces[10]] = ZAxisRotation(rotation[pieces[10]], -90.0);
-        rotation[pieces[20]] = ZAxisRotation(rotation[pieces[20]], -90.0);
-        rotation[pieces[24]] = ZAxisRotation(rotation[pieces[24]], -90.0);
-        rotation[pieces[25]] = ZAxisRotation(rotation[pieces[25]], -90.0);
-        rotation[pieces[21]] = ZAxisRotation(rotation[pieces[21]], -90.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], 32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], 32.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], 32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], 32.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], 32.0);
-        rotation[pieces[20]] = YAxisRotation(rotation[pieces[20]], 32.0);
-        rotation[pieces[24]] = YAxisRotation(rotation[pieces[24]], 32.0);
-        rotation[pieces[25]] = YAxisRotation(rotation[pieces[25]], 32.0);
-        rotation[pieces[21]] = YAxisRotation(rotation[pieces[21]], 32.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -22.0);
-        rotation[pieces[20]] = XAxisRotation(rotation[pieces[20]], -22.0);
-        rotation[pieces[24]] = XAxisRotation(rotation[pieces[24]], -22.0);
-        rotation[pieces[25]] = XAxisRotation(rotation[pieces[25]], -22.0);
-        rotation[pieces[21]] = XAxisRotation(rotation[pieces[21]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[6], pieces[10], pieces[9], pieces[11]);
-        swapPieces(pieces[20], pieces[21], pieces[25], pieces[24]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[8], edgeStickers[11], edgeStickers[10], edgeStickers[9]);
-        swapPieces(edgeStickers[2], edgeStickers[5], edgeStickers[20], edgeStickers[15]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[8], cornerStickers[11], cornerStickers[10], cornerStickers[9]);
-        swapPieces(cornerStickers[2], cornerStickers[5], cornerStickers[20], cornerStickers[15]);
-        swapPieces(cornerStickers[3], cornerStickers[6], cornerStickers[21], cornerStickers[12]);
-    }
-}
-
-// turn B face
-void turnBFace(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // B move
-    if (degree == 1)
-    {
-        // transform cube
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], 22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], 22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], 22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], 22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], 22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], 22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], 22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], 22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], 22.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], -32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], -32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], -32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], -32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], -32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], -32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], -32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], -32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], -32.0);
-        rotation[pieces[4]] = ZAxisRotation(rotation[pieces[4]], -90.0);
-        rotation[pieces[7]] = ZAxisRotation(rotation[pieces[7]], -90.0);
-        rotation[pieces[13]] = ZAxisRotation(rotation[pieces[13]], -90.0);
-        rotation[pieces[8]] = ZAxisRotation(rotation[pieces[8]], -90.0);
-        rotation[pieces[12]] = ZAxisRotation(rotation[pieces[12]], -90.0);
-        rotation[pieces[18]] = ZAxisRotation(rotation[pieces[18]], -90.0);
-        rotation[pieces[22]] = ZAxisRotation(rotation[pieces[22]], -90.0);
-        rotation[pieces[23]] = ZAxisRotation(rotation[pieces[23]], -90.0);
-        rotation[pieces[19]] = ZAxisRotation(rotation[pieces[19]], -90.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], 32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], 32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], 32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], 32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], 32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], 32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], 32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], 32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], 32.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[7], pieces[13], pieces[8], pieces[12]);
-        swapPieces(pieces[18], pieces[22], pieces[23], pieces[19]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[16], edgeStickers[17], edgeStickers[18], edgeStickers[19]);
-        swapPieces(edgeStickers[0], edgeStickers[7], edgeStickers[22], edgeStickers[13]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[16], cornerStickers[17], cornerStickers[18], cornerStickers[19]);
-        swapPieces(cornerStickers[0], cornerStickers[7], cornerStickers[22], cornerStickers[13]);
-        swapPieces(cornerStickers[1], cornerStickers[4], cornerStickers[23], cornerStickers[14]);
-    }
-    // B2 move
-    else if (degree == 2)
-    {
-        // transform cube
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], 22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], 22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], 22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], 22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], 22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], 22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], 22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], 22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], 22.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], -32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], -32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], -32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], -32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], -32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], -32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], -32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], -32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], -32.0);
-        rotation[pieces[4]] = ZAxisRotation(rotation[pieces[4]], 180.0);
-        rotation[pieces[7]] = ZAxisRotation(rotation[pieces[7]], 180.0);
-        rotation[pieces[13]] = ZAxisRotation(rotation[pieces[13]], 180.0);
-        rotation[pieces[8]] = ZAxisRotation(rotation[pieces[8]], 180.0);
-        rotation[pieces[12]] = ZAxisRotation(rotation[pieces[12]], 180.0);
-        rotation[pieces[18]] = ZAxisRotation(rotation[pieces[18]], 180.0);
-        rotation[pieces[22]] = ZAxisRotation(rotation[pieces[22]], 180.0);
-        rotation[pieces[23]] = ZAxisRotation(rotation[pieces[23]], 180.0);
-        rotation[pieces[19]] = ZAxisRotation(rotation[pieces[19]], 180.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], 32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], 32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], 32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], 32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], 32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], 32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], 32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], 32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], 32.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -22.0);
-        // save new positions of pieces
-        swap(pieces[7], pieces[8]);
-        swap(pieces[13], pieces[12]);
-        swap(pieces[18], pieces[23]);
-        swap(pieces[22], pieces[19]);
-        // save new positions of edge stickers
-        swap(edgeStickers[16], edgeStickers[18]);
-        swap(edgeStickers[17], edgeStickers[19]);
-        swap(edgeStickers[0], edgeStickers[22]);
-        swap(edgeStickers[7], edgeStickers[13]);
-        // save new positions of corner stickers
-        swap(cornerStickers[16], cornerStickers[18]);
-        swap(cornerStickers[17], cornerStickers[19]);
-        swap(cornerStickers[0], cornerStickers[22]);
-        swap(cornerStickers[7], cornerStickers[13]);
-        swap(cornerStickers[1], cornerStickers[23]);
-        swap(cornerStickers[4], cornerStickers[14]);
-    }
-    // B' move
-    else if (degree == 3)
-    {
-        // transform cube
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], 22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], 22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], 22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], 22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], 22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], 22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], 22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], 22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], 22.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], -32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], -32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], -32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], -32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], -32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], -32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], -32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], -32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], -32.0);
-        rotation[pieces[4]] = ZAxisRotation(rotation[pieces[4]], 90.0);
-        rotation[pieces[7]] = ZAxisRotation(rotation[pieces[7]], 90.0);
-        rotation[pieces[13]] = ZAxisRotation(rotation[pieces[13]], 90.0);
-        rotation[pieces[8]] = ZAxisRotation(rotation[pieces[8]], 90.0);
-        rotation[pieces[12]] = ZAxisRotation(rotation[pieces[12]], 90.0);
-        rotation[pieces[18]] = ZAxisRotation(rotation[pieces[18]], 90.0);
-        rotation[pieces[22]] = ZAxisRotation(rotation[pieces[22]], 90.0);
-        rotation[pieces[23]] = ZAxisRotation(rotation[pieces[23]], 90.0);
-        rotation[pieces[19]] = ZAxisRotation(rotation[pieces[19]], 90.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], 32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], 32.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], 32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], 32.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], 32.0);
-        rotation[pieces[18]] = YAxisRotation(rotation[pieces[18]], 32.0);
-        rotation[pieces[22]] = YAxisRotation(rotation[pieces[22]], 32.0);
-        rotation[pieces[23]] = YAxisRotation(rotation[pieces[23]], 32.0);
-        rotation[pieces[19]] = YAxisRotation(rotation[pieces[19]], 32.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -22.0);
-        rotation[pieces[18]] = XAxisRotation(rotation[pieces[18]], -22.0);
-        rotation[pieces[22]] = XAxisRotation(rotation[pieces[22]], -22.0);
-        rotation[pieces[23]] = XAxisRotation(rotation[pieces[23]], -22.0);
-        rotation[pieces[19]] = XAxisRotation(rotation[pieces[19]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[7], pieces[12], pieces[8], pieces[13]);
-        swapPieces(pieces[18], pieces[19], pieces[23], pieces[22]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[16], edgeStickers[19], edgeStickers[18], edgeStickers[17]);
-        swapPieces(edgeStickers[0], edgeStickers[13], edgeStickers[22], edgeStickers[7]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[16], cornerStickers[19], cornerStickers[18], cornerStickers[17]);
-        swapPieces(cornerStickers[0], cornerStickers[13], cornerStickers[22], cornerStickers[7]);
-        swapPieces(cornerStickers[1], cornerStickers[14], cornerStickers[23], cornerStickers[4]);
-    }
-}
-
-// turn M slice
-void turnMSlice(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // M move
-    if (degree == 1)
-    {
-        // transform cube
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], 22.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], 22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], 22.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], 22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], 22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], 22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], 22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], 22.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], -32.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], -32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], -32.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], -32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], -32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], -32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], -32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], -32.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -90.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -90.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -90.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -90.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -90.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -90.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -90.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -90.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], 32.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], 32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], 32.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], 32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], 32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], 32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], 32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], 32.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -22.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -22.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[0], pieces[2], pieces[5], pieces[4]);
-        swapPieces(pieces[6], pieces[9], pieces[8], pieces[7]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[0], edgeStickers[8], edgeStickers[20], edgeStickers[18]);
-        swapPieces(edgeStickers[2], edgeStickers[10], edgeStickers[22], edgeStickers[16]);
-    }
-    // M2 move
-    else if (degree == 2)
-    {
-        // transform cube
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], 22.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], 22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], 22.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], 22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], 22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], 22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], 22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], 22.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], -32.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], -32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], -32.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], -32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], -32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], -32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], -32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], -32.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], 180.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], 180.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], 180.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], 180.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], 180.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], 180.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], 180.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], 180.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], 32.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], 32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], 32.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], 32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], 32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], 32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], 32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], 32.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -22.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -22.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -22.0);
-        // save new positions of pieces
-        swap(pieces[0], pieces[5]);
-        swap(pieces[2], pieces[4]);
-        swap(pieces[6], pieces[8]);
-        swap(pieces[9], pieces[7]);
-        // save new positions of edge stickers
-        swap(edgeStickers[0], edgeStickers[20]);
-        swap(edgeStickers[8], edgeStickers[18]);
-        swap(edgeStickers[2], edgeStickers[22]);
-        swap(edgeStickers[10], edgeStickers[16]);
-    }
-    // M' move
-    else if (degree == 3)
-    {
-        // transform cube
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], 22.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], 22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], 22.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], 22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], 22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], 22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], 22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], 22.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], -32.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], -32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], -32.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], -32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], -32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], -32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], -32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], -32.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], 90.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], 90.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], 90.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], 90.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], 90.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], 90.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], 90.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], 90.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], 32.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], 32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], 32.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], 32.0);
-        rotation[pieces[6]] = YAxisRotation(rotation[pieces[6]], 32.0);
-        rotation[pieces[9]] = YAxisRotation(rotation[pieces[9]], 32.0);
-        rotation[pieces[8]] = YAxisRotation(rotation[pieces[8]], 32.0);
-        rotation[pieces[7]] = YAxisRotation(rotation[pieces[7]], 32.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -22.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -22.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -22.0);
-        rotation[pieces[6]] = XAxisRotation(rotation[pieces[6]], -22.0);
-        rotation[pieces[9]] = XAxisRotation(rotation[pieces[9]], -22.0);
-        rotation[pieces[8]] = XAxisRotation(rotation[pieces[8]], -22.0);
-        rotation[pieces[7]] = XAxisRotation(rotation[pieces[7]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[0], pieces[4], pieces[5], pieces[2]);
-        swapPieces(pieces[6], pieces[7], pieces[8], pieces[9]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[0], edgeStickers[18], edgeStickers[20], edgeStickers[8]);
-        swapPieces(edgeStickers[2], edgeStickers[16], edgeStickers[22], edgeStickers[10]);
-    }
-}
-
-// turn E slice
-void turnESlice(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // E move
-    if (degree == 1)
-    {
-        // transform cube
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], -90.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], -90.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], -90.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], -90.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], -90.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], -90.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], -90.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], -90.0);
-        rotation[pieces[1]] = ZAxisRotation(rotation[pieces[1]], -22.0);
-        rotation[pieces[2]] = ZAxisRotation(rotation[pieces[2]], -22.0);
-        rotation[pieces[3]] = ZAxisRotation(rotation[pieces[3]], -22.0);
-        rotation[pieces[4]] = ZAxisRotation(rotation[pieces[4]], -22.0);
-        rotation[pieces[10]] = ZAxisRotation(rotation[pieces[10]], -22.0);
-        rotation[pieces[11]] = ZAxisRotation(rotation[pieces[11]], -22.0);
-        rotation[pieces[12]] = ZAxisRotation(rotation[pieces[12]], -22.0);
-        rotation[pieces[13]] = ZAxisRotation(rotation[pieces[13]], -22.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -22.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -22.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -22.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[1], pieces[2], pieces[3], pieces[4]);
-        swapPieces(pieces[10], pieces[11], pieces[12], pieces[13]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[5], edgeStickers[9], edgeStickers[13], edgeStickers[17]);
-        swapPieces(edgeStickers[7], edgeStickers[11], edgeStickers[15], edgeStickers[19]);
-    }
-    // E2 move
-    else if (degree == 2)
-    {
-        // transform cube
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], 180.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], 180.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], 180.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], 180.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], 180.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], 180.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], 180.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], 180.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -44.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -44.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -44.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -44.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -44.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -44.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -44.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -44.0);
-        // save new positions of pieces
-        swap(pieces[1], pieces[3]);
-        swap(pieces[2], pieces[4]);
-        swap(pieces[10], pieces[12]);
-        swap(pieces[11], pieces[13]);
-        // save new positions of edge stickers
-        swap(edgeStickers[5], edgeStickers[13]);
-        swap(edgeStickers[9], edgeStickers[17]);
-        swap(edgeStickers[7], edgeStickers[15]);
-        swap(edgeStickers[11], edgeStickers[19]);
-    }
-    // E' move
-    else if (degree == 3)
-    {
-        // transform cube
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], 90.0);
-        rotation[pieces[2]] = YAxisRotation(rotation[pieces[2]], 90.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], 90.0);
-        rotation[pieces[4]] = YAxisRotation(rotation[pieces[4]], 90.0);
-        rotation[pieces[10]] = YAxisRotation(rotation[pieces[10]], 90.0);
-        rotation[pieces[11]] = YAxisRotation(rotation[pieces[11]], 90.0);
-        rotation[pieces[12]] = YAxisRotation(rotation[pieces[12]], 90.0);
-        rotation[pieces[13]] = YAxisRotation(rotation[pieces[13]], 90.0);
-        rotation[pieces[1]] = ZAxisRotation(rotation[pieces[1]], 22.0);
-        rotation[pieces[2]] = ZAxisRotation(rotation[pieces[2]], 22.0);
-        rotation[pieces[3]] = ZAxisRotation(rotation[pieces[3]], 22.0);
-        rotation[pieces[4]] = ZAxisRotation(rotation[pieces[4]], 22.0);
-        rotation[pieces[10]] = ZAxisRotation(rotation[pieces[10]], 22.0);
-        rotation[pieces[11]] = ZAxisRotation(rotation[pieces[11]], 22.0);
-        rotation[pieces[12]] = ZAxisRotation(rotation[pieces[12]], 22.0);
-        rotation[pieces[13]] = ZAxisRotation(rotation[pieces[13]], 22.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -22.0);
-        rotation[pieces[2]] = XAxisRotation(rotation[pieces[2]], -22.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -22.0);
-        rotation[pieces[4]] = XAxisRotation(rotation[pieces[4]], -22.0);
-        rotation[pieces[10]] = XAxisRotation(rotation[pieces[10]], -22.0);
-        rotation[pieces[11]] = XAxisRotation(rotation[pieces[11]], -22.0);
-        rotation[pieces[12]] = XAxisRotation(rotation[pieces[12]], -22.0);
-        rotation[pieces[13]] = XAxisRotation(rotation[pieces[13]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[1], pieces[4], pieces[3], pieces[2]);
-        swapPieces(pieces[10], pieces[13], pieces[12], pieces[11]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[5], edgeStickers[17], edgeStickers[13], edgeStickers[9]);
-        swapPieces(edgeStickers[7], edgeStickers[19], edgeStickers[15], edgeStickers[11]);
-    }
-}
-
-// turn S slice
-void turnSSlice(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // S move
-    if (degree == 1)
-    {
-        // transform cube
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], 22.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], 22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], 22.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], 22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], 22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], 22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], 22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], 22.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], -32.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], -32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], -32.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], -32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], -32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], -32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], -32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], -32.0);
-        rotation[pieces[0]] = ZAxisRotation(rotation[pieces[0]], 90.0);
-        rotation[pieces[3]] = ZAxisRotation(rotation[pieces[3]], 90.0);
-        rotation[pieces[5]] = ZAxisRotation(rotation[pieces[5]], 90.0);
-        rotation[pieces[1]] = ZAxisRotation(rotation[pieces[1]], 90.0);
-        rotation[pieces[14]] = ZAxisRotation(rotation[pieces[14]], 90.0);
-        rotation[pieces[15]] = ZAxisRotation(rotation[pieces[15]], 90.0);
-        rotation[pieces[16]] = ZAxisRotation(rotation[pieces[16]], 90.0);
-        rotation[pieces[17]] = ZAxisRotation(rotation[pieces[17]], 90.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], 32.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], 32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], 32.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], 32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], 32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], 32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], 32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], 32.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -22.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -22.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[0], pieces[3], pieces[5], pieces[1]);
-        swapPieces(pieces[14], pieces[15], pieces[16], pieces[17]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[1], edgeStickers[14], edgeStickers[23], edgeStickers[4]);
-        swapPieces(edgeStickers[3], edgeStickers[12], edgeStickers[21], edgeStickers[6]);
-    }
-    // S2 move
-    else if (degree == 2)
-    {
-        // transform cube
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], 22.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], 22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], 22.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], 22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], 22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], 22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], 22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], 22.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], -32.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], -32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], -32.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], -32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], -32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], -32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], -32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], -32.0);
-        rotation[pieces[0]] = ZAxisRotation(rotation[pieces[0]], 180.0);
-        rotation[pieces[3]] = ZAxisRotation(rotation[pieces[3]], 180.0);
-        rotation[pieces[5]] = ZAxisRotation(rotation[pieces[5]], 180.0);
-        rotation[pieces[1]] = ZAxisRotation(rotation[pieces[1]], 180.0);
-        rotation[pieces[14]] = ZAxisRotation(rotation[pieces[14]], 180.0);
-        rotation[pieces[15]] = ZAxisRotation(rotation[pieces[15]], 180.0);
-        rotation[pieces[16]] = ZAxisRotation(rotation[pieces[16]], 180.0);
-        rotation[pieces[17]] = ZAxisRotation(rotation[pieces[17]], 180.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], 32.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], 32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], 32.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], 32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], 32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], 32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], 32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], 32.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -22.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -22.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -22.0);
-        // save new positions of pieces
-        swap(pieces[0], pieces[5]);
-        swap(pieces[3], pieces[1]);
-        swap(pieces[14], pieces[16]);
-        swap(pieces[15], pieces[17]);
-        // save new positions of edge stickers
-        swap(edgeStickers[1], edgeStickers[23]);
-        swap(edgeStickers[14], edgeStickers[4]);
-        swap(edgeStickers[3], edgeStickers[21]);
-        swap(edgeStickers[12], edgeStickers[6]);
-    }
-    // S' move
-    else if (degree == 3)
-    {
-        // transform cube
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], 22.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], 22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], 22.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], 22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], 22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], 22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], 22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], 22.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], -32.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], -32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], -32.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], -32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], -32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], -32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], -32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], -32.0);
-        rotation[pieces[0]] = ZAxisRotation(rotation[pieces[0]], -90.0);
-        rotation[pieces[3]] = ZAxisRotation(rotation[pieces[3]], -90.0);
-        rotation[pieces[5]] = ZAxisRotation(rotation[pieces[5]], -90.0);
-        rotation[pieces[1]] = ZAxisRotation(rotation[pieces[1]], -90.0);
-        rotation[pieces[14]] = ZAxisRotation(rotation[pieces[14]], -90.0);
-        rotation[pieces[15]] = ZAxisRotation(rotation[pieces[15]], -90.0);
-        rotation[pieces[16]] = ZAxisRotation(rotation[pieces[16]], -90.0);
-        rotation[pieces[17]] = ZAxisRotation(rotation[pieces[17]], -90.0);
-        rotation[pieces[0]] = YAxisRotation(rotation[pieces[0]], 32.0);
-        rotation[pieces[3]] = YAxisRotation(rotation[pieces[3]], 32.0);
-        rotation[pieces[5]] = YAxisRotation(rotation[pieces[5]], 32.0);
-        rotation[pieces[1]] = YAxisRotation(rotation[pieces[1]], 32.0);
-        rotation[pieces[14]] = YAxisRotation(rotation[pieces[14]], 32.0);
-        rotation[pieces[15]] = YAxisRotation(rotation[pieces[15]], 32.0);
-        rotation[pieces[16]] = YAxisRotation(rotation[pieces[16]], 32.0);
-        rotation[pieces[17]] = YAxisRotation(rotation[pieces[17]], 32.0);
-        rotation[pieces[0]] = XAxisRotation(rotation[pieces[0]], -22.0);
-        rotation[pieces[3]] = XAxisRotation(rotation[pieces[3]], -22.0);
-        rotation[pieces[5]] = XAxisRotation(rotation[pieces[5]], -22.0);
-        rotation[pieces[1]] = XAxisRotation(rotation[pieces[1]], -22.0);
-        rotation[pieces[14]] = XAxisRotation(rotation[pieces[14]], -22.0);
-        rotation[pieces[15]] = XAxisRotation(rotation[pieces[15]], -22.0);
-        rotation[pieces[16]] = XAxisRotation(rotation[pieces[16]], -22.0);
-        rotation[pieces[17]] = XAxisRotation(rotation[pieces[17]], -22.0);
-        // save new positions of pieces
-        swapPieces(pieces[0], pieces[1], pieces[5], pieces[3]);
-        swapPieces(pieces[14], pieces[17], pieces[16], pieces[15]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[1], edgeStickers[4], edgeStickers[23], edgeStickers[14]);
-        swapPieces(edgeStickers[3], edgeStickers[6], edgeStickers[21], edgeStickers[12]);
-    }
-}
-
-// rotate cube about x-axis
-void rotateCubeX(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // X rotation
-    if (degree == 1)
+public:
+    // turn the given pieces by angle degrees about axis
+    virtual void turnLayer(const unsigned char* layer, int layerSize, char axis, float angle) = 0;
+};
+
+// cube state class
+// holds only the positions of the pieces and stickers of the cube, so turns cost nothing but byte swaps
+class CubeState
+{
+public:
+    // declare variables
+    unsigned char pieces[26];
+    unsigned char edgeStickers[24];
+    unsigned char cornerStickers[24];
+    CubeObserver* observer;
+
+    // constructor to initialize a solved cube with no observer
+    CubeState()
     {
-        // rotate cube
         for (int i = 0; i < 26; i++)
         {
-            rotation[i] = XAxisRotation(rotation[i], 22.0);
-            rotation[i] = YAxisRotation(rotation[i], -32.0);
-            rotation[i] = XAxisRotation(rotation[i], 90.0);
-            rotation[i] = YAxisRotation(rotation[i], 32.0);
-            rotation[i] = XAxisRotation(rotation[i], -22.0);
-        }
-        // save new positions of pieces
-        swapPieces(pieces[14], pieces[13], pieces[17], pieces[10]);
-        swapPieces(pieces[21], pieces[18], pieces[22], pieces[25]);
-        swapPieces(pieces[0], pieces[4], pieces[5], pieces[2]);
-        swapPieces(pieces[6], pieces[7], pieces[8], pieces[9]);
-        swapPieces(pieces[15], pieces[12], pieces[16], pieces[11]);
-        swapPieces(pieces[20], pieces[19], pieces[23], pieces[24]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[3], edgeStickers[17], edgeStickers[23], edgeStickers[11]);
-        swapPieces(edgeStickers[4], edgeStickers[7], edgeStickers[6], edgeStickers[5]);
-        swapPieces(edgeStickers[0], edgeStickers[18], edgeStickers[20], edgeStickers[8]);
-        swapPieces(edgeStickers[2], edgeStickers[16], edgeStickers[22], edgeStickers[10]);
-        swapPieces(edgeStickers[1], edgeStickers[19], edgeStickers[21], edgeStickers[9]);
-        swapPieces(edgeStickers[12], edgeStickers[13], edgeStickers[14], edgeStickers[15]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[3], cornerStickers[17], cornerStickers[23], cornerStickers[11]);
-        swapPieces(cornerStickers[4], cornerStickers[7], cornerStickers[6], cornerStickers[5]);
-        swapPieces(cornerStickers[0], cornerStickers[18], cornerStickers[20], cornerStickers[8]);
-        swapPieces(cornerStickers[1], cornerStickers[19], cornerStickers[21], cornerStickers[9]);
-        swapPieces(cornerStickers[12], cornerStickers[13], cornerStickers[14], cornerStickers[15]);
-        swapPieces(cornerStickers[2], cornerStickers[16], cornerStickers[22], cornerStickers[10]);
-    }
-    // X' rotation
-    else if (degree == 2)
-    {
-        // rotate cube
-        for (int i = 0; i < 26; i++)
+            pieces[i] = i;
+        }
+        for (int i = 0; i < 24; i++)
         {
-            rotation[i] = XAxisRotation(rotation[i], 22.0);
-            rotation[i] = YAxisRotation(rotation[i], -32.0);
-            rotation[i] = XAxisRotation(rotation[i], -90.0);
-            rotation[i] = YAxisRotation(rotation[i], 32.0);
-            rotation[i] = XAxisRotation(rotation[i], -22.0);
-        }
-        // save new positions of pieces
-        swapPieces(pieces[14], pieces[10], pieces[17], pieces[13]);
-        swapPieces(pieces[21], pieces[25], pieces[22], pieces[18]);
-        swapPieces(pieces[0], pieces[2], pieces[5], pieces[4]);
-        swapPieces(pieces[6], pieces[9], pieces[8], pieces[7]);
-        swapPieces(pieces[15], pieces[11], pieces[16], pieces[12]);
-        swapPieces(pieces[20], pieces[24], pieces[23], pieces[19]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[3], edgeStickers[11], edgeStickers[23], edgeStickers[17]);
-        swapPieces(edgeStickers[4], edgeStickers[5], edgeStickers[6], edgeStickers[7]);
-        swapPieces(edgeStickers[0], edgeStickers[8], edgeStickers[20], edgeStickers[18]);
-        swapPieces(edgeStickers[2], edgeStickers[10], edgeStickers[22], edgeStickers[16]);
-        swapPieces(edgeStickers[1], edgeStickers[9], edgeStickers[21], edgeStickers[19]);
-        swapPieces(edgeStickers[12], edgeStickers[15], edgeStickers[14], edgeStickers[13]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[3], cornerStickers[11], cornerStickers[23], cornerStickers[17]);
-        swapPieces(cornerStickers[4], cornerStickers[5], cornerStickers[6], cornerStickers[7]);
-        swapPieces(cornerStickers[0], cornerStickers[8], cornerStickers[20], cornerStickers[18]);
-        swapPieces(cornerStickers[2], cornerStickers[10], cornerStickers[22], cornerStickers[16]);
-        swapPieces(cornerStickers[1], cornerStickers[9], cornerStickers[21], cornerStickers[19]);
-        swapPieces(cornerStickers[12], cornerStickers[15], cornerStickers[14], cornerStickers[13]);
-    }
-}
-
-// rotate cube about y-axis
-void rotateCubeY(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // Y rotation
-    if (degree == 1)
+            edgeStickers[i] = i;
+            cornerStickers[i] = i;
+        }
+        observer = NULL;
+    }
+
+    // tell observer which pieces are about to turn
+    void notify(const unsigned char* positions, int count, char axis, float angle)
     {
-        // rotate cube
-        for (int i = 0; i < 26; i++)
+        if (observer != NULL)
         {
-            rotation[i] = XAxisRotation(rotation[i], 22.0);
-            rotation[i] = YAxisRotation(rotation[i], -32.0);
-            rotation[i] = YAxisRotation(rotation[i], 90.0);
-            rotation[i] = YAxisRotation(rotation[i], 32.0);
-            rotation[i] = XAxisRotation(rotation[i], -22.0);
-        }
-        // save new positions of pieces
-        swapPieces(pieces[7], pieces[15], pieces[6], pieces[14]);
-        swapPieces(pieces[18], pieces[19], pieces[20], pieces[21]);
-        swapPieces(pieces[1], pieces[4], pieces[3], pieces[2]);
-        swapPieces(pieces[10], pieces[13], pieces[12], pieces[11]);
-        swapPieces(pieces[8], pieces[16], pieces[9], pieces[17]);
-        swapPieces(pieces[22], pieces[23], pieces[24], pieces[25]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[0], edgeStickers[1], edgeStickers[2], edgeStickers[3]);
-        swapPieces(edgeStickers[16], edgeStickers[12], edgeStickers[8], edgeStickers[4]);
-        swapPieces(edgeStickers[5], edgeStickers[17], edgeStickers[13], edgeStickers[9]);
-        swapPieces(edgeStickers[7], edgeStickers[19], edgeStickers[15], edgeStickers[11]);
-        swapPieces(edgeStickers[20], edgeStickers[23], edgeStickers[22], edgeStickers[21]);
-        swapPieces(edgeStickers[6], edgeStickers[18], edgeStickers[14], edgeStickers[10]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[0], cornerStickers[1], cornerStickers[2], cornerStickers[3]);
-        swapPieces(cornerStickers[16], cornerStickers[12], cornerStickers[8], cornerStickers[4]);
-        swapPieces(cornerStickers[17], cornerStickers[13], cornerStickers[9], cornerStickers[5]);
-        swapPieces(cornerStickers[20], cornerStickers[23], cornerStickers[22], cornerStickers[21]);
-        swapPieces(cornerStickers[6], cornerStickers[18], cornerStickers[14], cornerStickers[10]);
-        swapPieces(cornerStickers[7], cornerStickers[19], cornerStickers[15], cornerStickers[11]);
-    }
-    // Y' rotation
-    else if (degree == 2)
+            unsigned char layer[26];
+            for (int i = 0; i < count; i++)
+            {
+                layer[i] = pieces[positions[i]];
+            }
+            observer->turnLayer(layer, count, axis, angle);
+        }
+    }
+};
+
+// declare the 24 rotations of a cube, and for each rotation, axis, and number of clockwise quarter turns, the rotation
+// that is reached
+glm::mat4 cubeRotations[24];
+unsigned char rotationTurns[24][3][4];
+
+// generate rotation tables
+void initRotationTables()
+{
+    glm::mat4 axisTurns[3] =
     {
-        // rotate cube
-        for (int i = 0; i < 26; i++)
-        {
-            rotation[i] = XAxisRotation(rotation[i], 22.0);
-            rotation[i] = YAxisRotation(rotation[i], -32.0);
-            rotation[i] = YAxisRotation(rotation[i], -90.0);
-            rotation[i] = YAxisRotation(rotation[i], 32.0);
-            rotation[i] = XAxisRotation(rotation[i], -22.0);
-        }
-        // save new positions of pieces
-        swapPieces(pieces[7], pieces[14], pieces[6], pieces[15]);
-        swapPieces(pieces[18], pieces[21], pieces[20], pieces[19]);
-        swapPieces(pieces[1], pieces[2], pieces[3], pieces[4]);
-        swapPieces(pieces[10], pieces[11], pieces[12], pieces[13]);
-        swapPieces(pieces[8], pieces[17], pieces[9], pieces[16]);
-        swapPieces(pieces[22], pieces[25], pieces[24], pieces[23]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[0], edgeStickers[3], edgeStickers[2], edgeStickers[1]);
-        swapPieces(edgeStickers[16], edgeStickers[4], edgeStickers[8], edgeStickers[12]);
-        swapPieces(edgeStickers[5], edgeStickers[9], edgeStickers[13], edgeStickers[17]);
-        swapPieces(edgeStickers[7], edgeStickers[11], edgeStickers[15], edgeStickers[19]);
-        swapPieces(edgeStickers[20], edgeStickers[21], edgeStickers[22], edgeStickers[23]);
-        swapPieces(edgeStickers[6], edgeStickers[10], edgeStickers[14], edgeStickers[18]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[0], cornerStickers[3], cornerStickers[2], cornerStickers[1]);
-        swapPieces(cornerStickers[16], cornerStickers[4], cornerStickers[8], cornerStickers[12]);
-        swapPieces(cornerStickers[5], cornerStickers[9], cornerStickers[13], cornerStickers[17]);
-        swapPieces(cornerStickers[7], cornerStickers[11], cornerStickers[15], cornerStickers[19]);
-        swapPieces(cornerStickers[20], cornerStickers[21], cornerStickers[22], cornerStickers[23]);
-        swapPieces(cornerStickers[6], cornerStickers[10], cornerStickers[14], cornerStickers[18]);
-    }
-}
-
-// rotate cube about z-axis
-void rotateCubeZ(int degree, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
-{
-    // Z rotation
-    if (degree == 1)
+        XAxisRotation(glm::mat4(1.0), 90.0),
+        YAxisRotation(glm::mat4(1.0), 90.0),
+        ZAxisRotation(glm::mat4(1.0), 90.0)
+    };
+
+    // find rotations breadth first from no rotation, rounding so every entry is exactly -1, 0, or 1
+    int count = 1;
+    cubeRotations[0] = glm::mat4(1.0);
+    for (int i = 0; i < count; i++)
     {
-        // rotate cube
-        for (int i = 0; i < 26; i++)
+        for (int axis = 0; axis < 3; axis++)
         {
-            rotation[i] = XAxisRotation(rotation[i], 22.0);
-            rotation[i] = YAxisRotation(rotation[i], -32.0);
-            rotation[i] = ZAxisRotation(rotation[i], 90.0);
-            rotation[i] = YAxisRotation(rotation[i], 32.0);
-            rotation[i] = XAxisRotation(rotation[i], -22.0);
-        }
-        // save new positions of pieces
-        swapPieces(pieces[6], pieces[11], pieces[9], pieces[10]);
-        swapPieces(pieces[20], pieces[24], pieces[25], pieces[21]);
-        swapPieces(pieces[0], pieces[3], pieces[5], pieces[1]);
-        swapPieces(pieces[14], pieces[15], pieces[16], pieces[17]);
-        swapPieces(pieces[7], pieces[12], pieces[8], pieces[13]);
-        swapPieces(pieces[18], pieces[19], pieces[23], pieces[22]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[8], edgeStickers[9], edgeStickers[10], edgeStickers[11]);
-        swapPieces(edgeStickers[2], edgeStickers[15], edgeStickers[20], edgeStickers[5]);
-        swapPieces(edgeStickers[1], edgeStickers[14], edgeStickers[23], edgeStickers[4]);
-        swapPieces(edgeStickers[3], edgeStickers[12], edgeStickers[21], edgeStickers[6]);
-        swapPieces(edgeStickers[16], edgeStickers[19], edgeStickers[18], edgeStickers[17]);
-        swapPieces(edgeStickers[0], edgeStickers[13], edgeStickers[22], edgeStickers[7]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[8], cornerStickers[9], cornerStickers[10], cornerStickers[11]);
-        swapPieces(cornerStickers[2], cornerStickers[15], cornerStickers[20], cornerStickers[5]);
-        swapPieces(cornerStickers[3], cornerStickers[12], cornerStickers[21], cornerStickers[6]);
-        swapPieces(cornerStickers[16], cornerStickers[19], cornerStickers[18], cornerStickers[17]);
-        swapPieces(cornerStickers[0], cornerStickers[13], cornerStickers[22], cornerStickers[7]);
-        swapPieces(cornerStickers[1], cornerStickers[14], cornerStickers[23], cornerStickers[4]);
-    }
-    // Z' rotation
-    else if (degree == 2)
+            glm::mat4 rotation = axisTurns[axis] * cubeRotations[i];
+            for (int j = 0; j < 4; j++)
+            {
+                rotation[j] = glm::round(rotation[j]);
+            }
+            int index = 0;
+            while (index < count && cubeRotations[index] != rotation)
+            {
+                index++;
+            }
+            if (index == count)
+            {
+                cubeRotations[count] = rotation;
+                count++;
+            }
+            rotationTurns[i][axis][0] = i;
+            rotationTurns[i][axis][1] = index;
+        }
+    }
+
+    // chain quarter turns into half and counter-clockwise turns
+    for (int i = 0; i < 24; i++)
     {
-        // rotate cube
-        for (int i = 0; i < 26; i++)
+        for (int axis = 0; axis < 3; axis++)
         {
-            rotation[i] = XAxisRotation(rotation[i], 22.0);
-            rotation[i] = YAxisRotation(rotation[i], -32.0);
-            rotation[i] = ZAxisRotation(rotation[i], -90.0);
-            rotation[i] = YAxisRotation(rotation[i], 32.0);
-            rotation[i] = XAxisRotation(rotation[i], -22.0);
-        }
-        // save new positions of pieces
-        swapPieces(pieces[6], pieces[10], pieces[9], pieces[11]);
-        swapPieces(pieces[20], pieces[21], pieces[25], pieces[24]);
-        swapPieces(pieces[0], pieces[1], pieces[5], pieces[3]);
-        swapPieces(pieces[14], pieces[17], pieces[16], pieces[15]);
-        swapPieces(pieces[7], pieces[13], pieces[8], pieces[12]);
-        swapPieces(pieces[18], pieces[22], pieces[23], pieces[19]);
-        // save new positions of edge stickers
-        swapPieces(edgeStickers[8], edgeStickers[11], edgeStickers[10], edgeStickers[9]);
-        swapPieces(edgeStickers[2], edgeStickers[5], edgeStickers[20], edgeStickers[15]);
-        swapPieces(edgeStickers[1], edgeStickers[4], edgeStickers[23], edgeStickers[14]);
-        swapPieces(edgeStickers[3], edgeStickers[6], edgeStickers[21], edgeStickers[12]);
-        swapPieces(edgeStickers[16], edgeStickers[17], edgeStickers[18], edgeStickers[19]);
-        swapPieces(edgeStickers[0], edgeStickers[7], edgeStickers[22], edgeStickers[13]);
-        // save new positions of corner stickers
-        swapPieces(cornerStickers[8], cornerStickers[11], cornerStickers[10], cornerStickers[9]);
-        swapPieces(cornerStickers[2], cornerStickers[5], cornerStickers[20], cornerStickers[15]);
-        swapPieces(cornerStickers[3], cornerStickers[6], cornerStickers[21], cornerStickers[12]);
-        swapPieces(cornerStickers[16], cornerStickers[17], cornerStickers[18], cornerStickers[19]);
-        swapPieces(cornerStickers[0], cornerStickers[7], cornerStickers[22], cornerStickers[13]);
-        swapPieces(cornerStickers[1], cornerStickers[4], cornerStickers[23], cornerStickers[14]);
+            for (int turns = 2; turns < 4; turns++)
+            {
+                rotationTurns[i][axis][turns] = rotationTurns[rotationTurns[i][axis][turns - 1]][axis][1];
+            }
+        }
     }
 }
 
-// check if cube is solved
-bool isSolved(string check, int* pieces, int* edgeStickers, int* cornerStickers)
+// cube renderer class
+// observes a cube state and keeps the rotation of each piece that is used to render it
+class CubeRenderer : public CubeObserver
 {
-    // declare variable that contains whether or not the cube is solved
-    bool solved = true;
-    // check if edges are solved
-    if (check == "CUBE" || check == "EDGES")
+public:
+    // declare variables
+    unsigned char orientation[26];
+    // last turn, with a bit set in the mask for each piece that it turned
+    GLint turnMask;
+    glm::vec3 turnAxis;
+    float turnAngle;
+    // whether the cube has changed since it was last drawn
+    bool dirty;
+
+    // constructor to start all pieces unrotated
+    CubeRenderer()
     {
-        // check if edges are solved
-        for (int i = 0; i < 6; i++)
+        for (int i = 0; i < 26; i++)
         {
-            if (edgeStickers[4 * i] + edgeStickers[4 * i + 1] + edgeStickers[4 * i + 2] + edgeStickers[4 * i + 3] != 16 * pieces[i] + 6)
-            {
-                solved = false;
-                break;
-            }
+            orientation[i] = 0;
         }
+        turnMask = 0;
+        turnAxis = glm::vec3(1.0f, 0.0f, 0.0f);
+        turnAngle = 0.0f;
+        dirty = true;
     }
-    // check if corners are solved
-    if (check == "CUBE" || check == "CORNERS")
+
+    // turn pieces of a layer
+    void turnLayer(const unsigned char* layer, int layerSize, char axis, float angle)
     {
-        for (int i = 0; i < 6; i++)
+        // angles are multiples of 90 degrees, so turning is a lookup of the rotation that is reached
+        int turns = (((int)glm::round(angle / 90.0f)) % 4 + 4) % 4;
+        turnMask = 0;
+        for (int i = 0; i < layerSize; i++)
         {
-            if (cornerStickers[4 * i] + cornerStickers[4 * i + 1] + cornerStickers[4 * i + 2] + cornerStickers[4 * i + 3] != 16 * pieces[i] + 6)
-            {
-                solved = false;
-                break;
-            }
+            orientation[layer[i]] = rotationTurns[orientation[layer[i]]][axis - 'X'][turns];
+            turnMask |= 1 << layer[i];
         }
+
+        // remember turn so that it can be animated
+        turnAxis = glm::vec3(axis == 'X' ? 1.0f : 0.0f, axis == 'Y' ? 1.0f : 0.0f, axis == 'Z' ? 1.0f : 0.0f);
+        turnAngle = angle;
+        dirty = true;
+    }
+};
+
+// upload uniforms of cubes, returns whether the inside of the cube can be seen
+bool uploadCubes(CubeMesh& mesh, const ShaderUniforms& uniforms, const glm::mat4& viewProj, const CubeRenderer& renderer, double turnProgress)
+{
+    // vertices are stored in their solved positions, so rotating a piece into place is its whole model matrix
+    glm::mat4 models[26];
+    for (int i = 0; i < 26; i++)
+    {
+        models[i] = cubeRotations[renderer.orientation[i]];
     }
 
-    return solved;
-}
+    // the last turn has already been made, so the vertex shader draws its pieces turned back by the part that is left
+    float turnAngle = glm::radians(renderer.turnAngle) * (float)(turnProgress - 1.0);
+    glUniform3f(uniforms.turnAxis, renderer.turnAxis.x, renderer.turnAxis.y, renderer.turnAxis.z);
+    glUniform1i(uniforms.turnMask, renderer.turnMask);
+    glUniform1f(uniforms.turnAngle, turnAngle);
+    mesh.upload(uniforms, viewProj, models);
 
-// perform edge swap algorithm
-void edgeSwap(GLFWwindow* window, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26], Cube* cubes, GLuint core_program, glm::mat4 proj, glm::mat4 view)
-{
-    // perform algorithm and render cubes after each turn
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(2, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
+    // the inside of the cube can only be seen while a layer is part way through a turn
+    return turnAngle != 0.0f;
 }
 
-// perform corner swap algorithm
-void cornerSwap(GLFWwindow* window, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26], Cube* cubes, GLuint core_program, glm::mat4 proj, glm::mat4 view)
-{
-    // perform algorithm and render cubes after each turn
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
+// draw cubes with the uniforms that were uploaded
+void drawCubes(CubeMesh& mesh, bool drawBody)
+{
+    // clear
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    // render cubes, the fragment shader draws the outline of each square so one pass is enough
+    mesh.draw(drawBody);
 }
 
-// perform parity algorithm
-void parity(GLFWwindow* window, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26], Cube* cubes, GLuint core_program, glm::mat4 proj, glm::mat4 view)
-{
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(2, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
-    turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-    renderCubes(window, cubes, core_program, proj, view, rotation);
-    delay(0.2);
+// render cubes
+void renderCubes(CubeMesh& mesh, const ShaderUniforms& uniforms, const glm::mat4& viewProj, const CubeRenderer& renderer, double turnProgress)
+{
+    drawCubes(mesh, uploadCubes(mesh, uniforms, viewProj, renderer, turnProgress));
 }
 
-// orient cube
-void orientCube(int frontFace, int topFace, GLFWwindow* window, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26], Cube* cubes, GLuint core_program, glm::mat4 proj, glm::mat4 view)
+// frame timer class
+// adds up the time each frame spends on the CPU and reports it once a second
+class FrameTimer
 {
-    // orient front face
-    for (int i = 0; i < 3; i++)
+private:
+    // declare variables
+    double totalTime;
+    double maxTime;
+    int frames;
+    double reportTime;
+public:
+    // constructor to start with no frames
+    FrameTimer()
     {
-        // check if front face is already oriented
-        if (pieces[2] == frontFace)
-        {
-            break;
-        }
-        // rotate cube
-        else
+        totalTime = 0.0;
+        maxTime = 0.0;
+        frames = 0;
+        reportTime = glfwGetTime();
+    }
+
+    // add time of a frame
+    void addFrame(double frameTime, double currentTime)
+    {
+        totalTime += frameTime;
+        maxTime = max(maxTime, frameTime);
+        frames++;
+        if (currentTime - reportTime >= 1.0)
         {
-            rotateCubeY(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            cout << "Frame CPU time: " << 1000.0 * totalTime / frames << " ms mean, " << 1000.0 * maxTime << " ms max over " << frames << " frames" << endl;
+            totalTime = 0.0;
+            maxTime = 0.0;
+            frames = 0;
+            reportTime = currentTime;
         }
     }
-    // orient front face if it is on the top or bottom
-    if (pieces[2] != frontFace)
+};
+
+// declare stages of a frame that are profiled
+enum ProfileStage
+{
+    INPUT_STAGE, UPDATE_STAGE, RENDER_STAGE, SWAP_STAGE, NUM_PROFILE_STAGES
+};
+const char* profileStageNames[NUM_PROFILE_STAGES] = {"input", "update", "render", "swap"};
+
+// scoped timer class
+// adds the CPU time from when it is made until it goes out of scope to a total
+class ScopedTimer
+{
+private:
+    // declare variables
+    double& total;
+    chrono::steady_clock::time_point start;
+public:
+    // constructor to start timing
+    ScopedTimer(double& total) : total(total)
     {
-        rotateCubeX(1, pieces, edgeStickers, cornerStickers, rotation);
+        start = chrono::steady_clock::now();
     }
-    if (pieces[2] != frontFace)
+
+    // destructor to add time taken
+    ~ScopedTimer()
     {
-        rotateCubeX(2, pieces, edgeStickers, cornerStickers, rotation);
+        total += chrono::duration<double>(chrono::steady_clock::now() - start).count();
     }
+};
 
-    // orient top face
-    for (int i = 0; i < 3; i++)
+// declare number of lines a profile log holds before it is moved aside and a new one is started
+const int PROFILE_LOG_LINES = 3600;
+
+// frame profiler class
+// adds up the CPU time of each stage of a frame and the GPU time of drawing, and reports them once a second
+// in the window title and in a log file that rolls over to a second file when it is full
+// GPU time is measured with two timer queries used in turn, so a result is only read a frame after it was asked for
+// and is skipped rather than waited for if it still isn't ready
+class FrameProfiler
+{
+private:
+    // declare variables
+    GLFWwindow* window;
+    GLuint queries[2];
+    bool queryPending[2];
+    int currentQuery;
+    double stageTotals[NUM_PROFILE_STAGES];
+    double gpuTotal;
+    int gpuFrames;
+    int frames;
+    double reportTime;
+    string logPath;
+    ofstream log;
+    int logLines;
+public:
+    // constructor to create queries and open log
+    FrameProfiler(GLFWwindow* window, string logPath)
     {
-        // check if top face is already oriented
-        if (pieces[0] == topFace)
-        {
-            break;
-        }
-        // rotate cube
-        else
-        {
-            rotateCubeZ(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+        this->window = window;
+        glGenQueries(2, this->queries);
+        queryPending[0] = false;
+        queryPending[1] = false;
+        currentQuery = 0;
+        for (int i = 0; i < NUM_PROFILE_STAGES; i++)
+        {
+            stageTotals[i] = 0.0;
+        }
+        gpuTotal = 0.0;
+        gpuFrames = 0;
+        frames = 0;
+        reportTime = glfwGetTime();
+        this->logPath = logPath;
+        log.open(logPath.c_str());
+        logLines = 0;
+        if (!log)
+        {
+            cout << "ERROR::PROFILER::COULD_NOT_OPEN_LOG" << endl;
         }
     }
-}
 
-// solve edges
-void solveEdges(GLFWwindow* window, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26], Cube* cubes, GLuint core_program, glm::mat4 proj, glm::mat4 view)
-{
-    // check if edges are already solved
-    if (isSolved("EDGES", pieces, edgeStickers, cornerStickers) == false)
+    // destructor to delete queries
+    ~FrameProfiler()
     {
-        int target;
-        // find target piece if edge buffer piece is in buffer position
-        if (pieces[15] == 15)
-        {
-            // choose an unsolved piece as target
-            for (int i = 0; i < 24; i++)
-            {
-                if (edgeStickers[i] != i && i != 1 && i != 12)
-                {
-                    target = i;
-                    break;
-                }
-            }
-        }
-        // find target piece if edge buffer piece is not in buffer position
-        else
-        {
-            // find target piece
-            target = edgeStickers[1];
-        }
-        // move target piece into setup position
-        if (target == 0)
-        {
-            turnMSlice(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 2)
-        {
-            turnMSlice(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 4)
+        glDeleteQueries(2, this->queries);
+    }
+
+    // start timing drawing on the GPU
+    void beginGpu()
+    {
+        glBeginQuery(GL_TIME_ELAPSED, queries[currentQuery]);
+    }
+
+    // stop timing drawing on the GPU
+    void endGpu()
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        queryPending[currentQuery] = true;
+    }
+
+    // add CPU time of each stage of a frame that was drawn
+    void addFrame(const double* stageTimes, double currentTime)
+    {
+        for (int i = 0; i < NUM_PROFILE_STAGES; i++)
         {
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            stageTotals[i] += stageTimes[i];
         }
-        else if (target == 5)
+        frames++;
+
+        // the other query was asked for last frame, so it is usually ready and is read before it is used again
+        currentQuery = 1 - currentQuery;
+        if (queryPending[currentQuery])
         {
-            turnESlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            GLint available = GL_FALSE;
+            glGetQueryObjectiv(queries[currentQuery], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available)
+            {
+                GLuint64 elapsed = 0;
+                glGetQueryObjectui64v(queries[currentQuery], GL_QUERY_RESULT, &elapsed);
+                gpuTotal += elapsed / 1e9;
+                gpuFrames++;
+            }
+            queryPending[currentQuery] = false;
         }
-        else if (target == 6)
+
+        if (currentTime - reportTime >= 1.0)
         {
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            report(currentTime);
         }
-        else if (target == 7)
+    }
+
+    // report mean times in milliseconds and start adding up again
+    void report(double currentTime)
+    {
+        stringstream line;
+        line.precision(3);
+        line << fixed;
+        for (int i = 0; i < NUM_PROFILE_STAGES; i++)
         {
-            turnESlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            line << profileStageNames[i] << " " << 1000.0 * stageTotals[i] / frames << " ms, ";
+            stageTotals[i] = 0.0;
         }
-        else if (target == 8)
+        line << "GPU " << (gpuFrames > 0 ? 1000.0 * gpuTotal / gpuFrames : 0.0) << " ms";
+        glfwSetWindowTitle(window, ("Rubik's Cube Solver - " + line.str()).c_str());
+
+        // move a full log aside so it never grows past two files
+        if (logLines == PROFILE_LOG_LINES)
+        {
+            // rename fails on windows if the old log is still there, so it is removed first
+            log.close();
+            remove((logPath + ".1").c_str());
+            rename(logPath.c_str(), (logPath + ".1").c_str());
+            log.open(logPath.c_str());
+            logLines = 0;
+        }
+        log << currentTime << " s, " << frames << " frames, " << line.str() << endl;
+        logLines++;
+
+        gpuTotal = 0.0;
+        gpuFrames = 0;
+        frames = 0;
+        reportTime = currentTime;
+    }
+};
+
+// declare layers of cube
+enum Layer
+{
+    U_FACE, D_FACE, L_FACE, R_FACE, F_FACE, B_FACE, // faces
+    M_SLICE, E_SLICE, S_SLICE, // slices
+    X_AXIS, Y_AXIS, Z_AXIS // whole cube rotations
+};
+
+// a move is a layer and a degree packed into one byte, 3 * layer + degree - 1
+// degree 1 is a clockwise quarter turn, degree 2 is a half turn, and degree 3 is a counter-clockwise quarter turn
+typedef unsigned char Move;
+const int NUM_MOVES = 36;
+
+// get move from layer and degree
+inline Move makeMove(int layer, int degree)
+{
+    return 3 * layer + degree - 1;
+}
+
+// quarter turn structure
+// describes the clockwise quarter turn of a layer as cycles of four positions that pieces and stickers move along
+// unused cycles are left as zeros and have no effect
+struct QuarterTurn
+{
+    char axis;
+    float angle;
+    int layerSize;
+    int layer[26];
+    int pieceCycles[6][4];
+    int edgeCycles[6][4];
+    int cornerCycles[6][4];
+};
+
+// declare clockwise quarter turn of each layer
+const QuarterTurn quarterTurns[12] =
+{
+    // U face
+    {
+        'Y', 90.0, 9, { 0, 7, 15, 6, 14, 18, 19, 20, 21 },
+        { { 7, 15, 6, 14 }, { 18, 19, 20, 21 } },
+        { { 0, 1, 2, 3 }, { 16, 12, 8, 4 } },
+        { { 0, 1, 2, 3 }, { 16, 12, 8, 4 }, { 17, 13, 9, 5 } }
+    },
+    // D face
+    {
+        'Y', -90.0, 9, { 5, 8, 16, 9, 17, 22, 23, 24, 25 },
+        { { 9, 16, 8, 17 }, { 24, 23, 22, 25 } },
+        { { 20, 21, 22, 23 }, { 6, 10, 14, 18 } },
+        { { 20, 21, 22, 23 }, { 6, 10, 14, 18 }, { 7, 11, 15, 19 } }
+    },
+    // L face
+    {
+        'X', -90.0, 9, { 1, 10, 13, 14, 17, 18, 21, 22, 25 },
+        { { 14, 10, 17, 13 }, { 21, 25, 22, 18 } },
+        { { 3, 11, 23, 17 }, { 4, 5, 6, 7 } },
+        { { 3, 11, 23, 17 }, { 4, 5, 6, 7 }, { 0, 8, 20, 18 } }
+    },
+    // R face
+    {
+        'X', 90.0, 9, { 3, 15, 12, 16, 11, 20, 19, 23, 24 },
+        { { 15, 12, 16, 11 }, { 20, 19, 23, 24 } },
+        { { 1, 19, 21, 9 }, { 12, 13, 14, 15 } },
+        { { 1, 19, 21, 9 }, { 12, 13, 14, 15 }, { 2, 16, 22, 10 } }
+    },
+    // F face
+    {
+        'Z', 90.0, 9, { 2, 6, 11, 9, 10, 20, 24, 25, 21 },
+        { { 6, 11, 9, 10 }, { 20, 24, 25, 21 } },
+        { { 8, 9, 10, 11 }, { 2, 15, 20, 5 } },
+        { { 8, 9, 10, 11 }, { 2, 15, 20, 5 }, { 3, 12, 21, 6 } }
+    },
+    // B face
+    {
+        'Z', -90.0, 9, { 4, 7, 13, 8, 12, 18, 22, 23, 19 },
+        { { 7, 13, 8, 12 }, { 18, 22, 23, 19 } },
+        { { 16, 17, 18, 19 }, { 0, 7, 22, 13 } },
+        { { 16, 17, 18, 19 }, { 0, 7, 22, 13 }, { 1, 4, 23, 14 } }
+    },
+    // M slice
+    {
+        'X', -90.0, 8, { 0, 2, 5, 4, 6, 9, 8, 7 },
+        { { 0, 2, 5, 4 }, { 6, 9, 8, 7 } },
+        { { 0, 8, 20, 18 }, { 2, 10, 22, 16 } },
+        { }
+    },
+    // E slice
+    {
+        'Y', -90.0, 8, { 1, 2, 3, 4, 10, 11, 12, 13 },
+        { { 1, 2, 3, 4 }, { 10, 11, 12, 13 } },
+        { { 5, 9, 13, 17 }, { 7, 11, 15, 19 } },
+        { }
+    },
+    // S slice
+    {
+        'Z', 90.0, 8, { 0, 3, 5, 1, 14, 15, 16, 17 },
+        { { 0, 3, 5, 1 }, { 14, 15, 16, 17 } },
+        { { 1, 14, 23, 4 }, { 3, 12, 21, 6 } },
+        { }
+    },
+    // x rotation
+    {
+        'X', 90.0, 26, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25 },
+        { { 14, 13, 17, 10 }, { 21, 18, 22, 25 }, { 0, 4, 5, 2 }, { 6, 7, 8, 9 }, { 15, 12, 16, 11 }, { 20, 19, 23, 24 } },
+        { { 3, 17, 23, 11 }, { 4, 7, 6, 5 }, { 0, 18, 20, 8 }, { 2, 16, 22, 10 }, { 1, 19, 21, 9 }, { 12, 13, 14, 15 } },
+        { { 3, 17, 23, 11 }, { 4, 7, 6, 5 }, { 0, 18, 20, 8 }, { 1, 19, 21, 9 }, { 12, 13, 14, 15 }, { 2, 16, 22, 10 } }
+    },
+    // y rotation
+    {
+        'Y', 90.0, 26, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25 },
+        { { 7, 15, 6, 14 }, { 18, 19, 20, 21 }, { 1, 4, 3, 2 }, { 10, 13, 12, 11 }, { 8, 16, 9, 17 }, { 22, 23, 24, 25 } },
+        { { 0, 1, 2, 3 }, { 16, 12, 8, 4 }, { 5, 17, 13, 9 }, { 7, 19, 15, 11 }, { 20, 23, 22, 21 }, { 6, 18, 14, 10 } },
+        { { 0, 1, 2, 3 }, { 16, 12, 8, 4 }, { 17, 13, 9, 5 }, { 20, 23, 22, 21 }, { 6, 18, 14, 10 }, { 7, 19, 15, 11 } }
+    },
+    // z rotation
+    {
+        'Z', 90.0, 26, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25 },
+        { { 6, 11, 9, 10 }, { 20, 24, 25, 21 }, { 0, 3, 5, 1 }, { 14, 15, 16, 17 }, { 7, 12, 8, 13 }, { 18, 19, 23, 22 } },
+        { { 8, 9, 10, 11 }, { 2, 15, 20, 5 }, { 1, 14, 23, 4 }, { 3, 12, 21, 6 }, { 16, 19, 18, 17 }, { 0, 13, 22, 7 } },
+        { { 8, 9, 10, 11 }, { 2, 15, 20, 5 }, { 3, 12, 21, 6 }, { 16, 19, 18, 17 }, { 0, 13, 22, 7 }, { 1, 14, 23, 4 } }
+    }
+};
+
+// move table structure
+// for every position, the position that its piece or sticker is gathered from when the move is made
+struct MoveTable
+{
+    unsigned char pieces[26];
+    unsigned char edgeStickers[24];
+    unsigned char cornerStickers[24];
+    unsigned char layer[26];
+    unsigned char layerSize;
+    char axis;
+    float angle;
+};
+
+// declare move tables
+MoveTable moveTables[NUM_MOVES];
+
+// generate move tables
+void initMoveTables()
+{
+    for (int i = 0; i < 12; i++)
+    {
+        const QuarterTurn& quarterTurn = quarterTurns[i];
+        // turn a solved cube one quarter turn at a time, so each position holds the position it came from
+        CubeState cube;
+        for (int degree = 1; degree <= 3; degree++)
         {
-            turnMSlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            for (int j = 0; j < 6; j++)
+            {
+                const int* cycle = quarterTurn.pieceCycles[j];
+                swapPieces(cube.pieces[cycle[0]], cube.pieces[cycle[1]], cube.pieces[cycle[2]], cube.pieces[cycle[3]]);
+                cycle = quarterTurn.edgeCycles[j];
+                swapPieces(cube.edgeStickers[cycle[0]], cube.edgeStickers[cycle[1]], cube.edgeStickers[cycle[2]], cube.edgeStickers[cycle[3]]);
+                cycle = quarterTurn.cornerCycles[j];
+                swapPieces(cube.cornerStickers[cycle[0]], cube.cornerStickers[cycle[1]], cube.cornerStickers[cycle[2]], cube.cornerStickers[cycle[3]]);
+            }
+
+            // save table
+            MoveTable& table = moveTables[makeMove(i, degree)];
+            memcpy(table.pieces, cube.pieces, sizeof(table.pieces));
+            memcpy(table.edgeStickers, cube.edgeStickers, sizeof(table.edgeStickers));
+            memcpy(table.cornerStickers, cube.cornerStickers, sizeof(table.cornerStickers));
+            for (int j = 0; j < quarterTurn.layerSize; j++)
+            {
+                table.layer[j] = quarterTurn.layer[j];
+            }
+            table.layerSize = quarterTurn.layerSize;
+            table.axis = quarterTurn.axis;
+            table.angle = degree == 3 ? -quarterTurn.angle : degree * quarterTurn.angle;
         }
-        else if (target == 9)
+    }
+}
+
+// make a move
+void applyMove(CubeState& cube, Move move)
+{
+    const MoveTable& table = moveTables[move];
+
+    // tell observer about turn
+    cube.notify(table.layer, table.layerSize, table.axis, table.angle);
+
+    // gather pieces and stickers into their new positions
+    CubeState old = cube;
+    for (int i = 0; i < 26; i++)
+    {
+        cube.pieces[i] = old.pieces[table.pieces[i]];
+    }
+    for (int i = 0; i < 24; i++)
+    {
+        cube.edgeStickers[i] = old.edgeStickers[table.edgeStickers[i]];
+        cube.cornerStickers[i] = old.cornerStickers[table.cornerStickers[i]];
+    }
+}
+
+// get move that undoes a move
+inline Move inverseMove(Move move)
+{
+    // swap degree 1 and degree 3, degree 2 is its own inverse
+    return move - move % 3 + 2 - move % 3;
+}
+
+// random generator class
+// xoshiro256**, which is much faster than rand() and gives the same numbers on every platform for a seed
+class RandomGenerator
+{
+private:
+    // declare variables
+    unsigned long long state[4];
+
+    // rotate bits left
+    static unsigned long long rotateLeft(unsigned long long x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+public:
+    // constructor to seed generator
+    RandomGenerator(unsigned long long seed)
+    {
+        this->seed(seed);
+    }
+
+    // seed generator, the state is filled with splitmix64 so that similar seeds give unrelated numbers
+    void seed(unsigned long long seed)
+    {
+        for (int i = 0; i < 4; i++)
         {
-            turnESlice(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            seed += 0x9E3779B97F4A7C15ULL;
+            unsigned long long z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            state[i] = z ^ (z >> 31);
         }
-        else if (target == 10)
+    }
+
+    // get next 64 random bits
+    unsigned long long next()
+    {
+        unsigned long long result = rotateLeft(state[1] * 5, 7) * 9;
+        unsigned long long shifted = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotateLeft(state[3], 45);
+        return result;
+    }
+
+    // move 2^128 numbers ahead, so copies of a generator that are each jumped a different number of times never overlap
+    void jump()
+    {
+        static const unsigned long long JUMP[4] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+        unsigned long long jumped[4] = { 0, 0, 0, 0 };
+        for (int i = 0; i < 4; i++)
         {
-            turnMSlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            for (int b = 0; b < 64; b++)
+            {
+                if (JUMP[i] & (1ULL << b))
+                {
+                    for (int j = 0; j < 4; j++)
+                    {
+                        jumped[j] ^= state[j];
+                    }
+                }
+                next();
+            }
         }
-        else if (target == 11)
+        memcpy(state, jumped, sizeof(state));
+    }
+
+    // get number from 0 to n - 1, rejecting the few values that would make some numbers more likely than others
+    int below(int n)
+    {
+        unsigned int threshold = (0u - n) % n;
+        unsigned int x;
+        do
         {
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 13)
+            x = next() >> 32;
+        } while (x < threshold);
+        return x % n;
+    }
+};
+
+// declare seed that every random generator starts from, main sets it before any thread makes random numbers
+unsigned long long randomSeed = 0;
+
+// make random generator for a new thread, jumped once more than the one before so no two threads share numbers
+RandomGenerator makeThreadGenerator()
+{
+    static atomic<int> threadCount(0);
+    RandomGenerator generator(randomSeed);
+    int jumps = threadCount++;
+    for (int i = 0; i < jumps; i++)
+    {
+        generator.jump();
+    }
+    return generator;
+}
+
+// declare random generator, each thread has its own, made the first time that thread uses it
+thread_local RandomGenerator randomGenerator = makeThreadGenerator();
+
+// generate random scramble of face turns, never turning the same face twice in a row
+void generateScramble(RandomGenerator& generator, Move* moves, int length)
+{
+    int lastFace = -1;
+    for (int i = 0; i < length; i++)
+    {
+        int move;
+        do
         {
-            turnESlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 14)
+            move = generator.below(18);
+        } while (move / 3 == lastFace);
+        moves[i] = move;
+        lastFace = move / 3;
+    }
+}
+
+// check if cube is solved
+bool isSolved(string check, const CubeState& cube)
+{
+    // declare variable that contains whether or not the cube is solved
+    bool solved = true;
+    // check if edges are solved
+    if (check == "CUBE" || check == "EDGES")
+    {
+        // check if edges are solved
+        for (int i = 0; i < 6; i++)
         {
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnMSlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            if (cube.edgeStickers[4 * i] + cube.edgeStickers[4 * i + 1] + cube.edgeStickers[4 * i + 2] + cube.edgeStickers[4 * i + 3] != 16 * cube.pieces[i] + 6)
+            {
+                solved = false;
+                break;
+            }
         }
-        else if (target == 15)
+    }
+    // check if corners are solved
+    if (check == "CUBE" || check == "CORNERS")
+    {
+        for (int i = 0; i < 6; i++)
         {
-            turnESlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            if (cube.cornerStickers[4 * i] + cube.cornerStickers[4 * i + 1] + cube.cornerStickers[4 * i + 2] + cube.cornerStickers[4 * i + 3] != 16 * cube.pieces[i] + 6)
+            {
+                solved = false;
+                break;
+            }
         }
-        else if (target == 16)
+    }
+
+    return solved;
+}
+
+// packed cube structure
+// stores a cube as one byte per slot in two 16 byte vectors, so a move is one byte shuffle per vector
+// each byte holds the piece in the slot in its low four bits and the orientation of that piece in its high four bits
+// edges holds the 12 edge slots, corners holds the 8 corner slots followed by the 6 centres, and unused bytes never change
+struct PackedCube
+{
+    alignas(16) unsigned char edges[16];
+    alignas(16) unsigned char corners[16];
+};
+
+// packed move structure
+// for every byte, the byte that is shuffled into it and the orientation change that is added to it
+struct PackedMove
+{
+    alignas(16) unsigned char edgeShuffle[16];
+    alignas(16) unsigned char edgeFlip[16];
+    alignas(16) unsigned char cornerShuffle[16];
+    alignas(16) unsigned char cornerTwist[16];
+};
+
+// declare packed moves and solved packed cube
+PackedMove packedMoves[NUM_MOVES];
+PackedCube solvedPackedCube;
+
+// declare stickers of each slot, starting with the sticker on the U or D face (or the F or B face for E slice edges)
+// and going around the piece in the same direction for every slot
+unsigned char edgeSlotStickers[12][2];
+unsigned char cornerSlotStickers[8][3];
+
+// declare slot and orientation of each sticker, packed like the bytes of a packed cube
+unsigned char edgeStickerCodes[24];
+unsigned char cornerStickerCodes[24];
+
+// check if a sticker is on the U or D face
+inline bool isUDSticker(int sticker)
+{
+    return sticker < 4 || sticker >= 20;
+}
+
+// check if a sticker is on the F or B face
+inline bool isFBSticker(int sticker)
+{
+    return (sticker >= 8 && sticker < 12) || (sticker >= 16 && sticker < 20);
+}
+
+// generate packed moves from move tables
+void initPackedMoves()
+{
+    // find where each position is sent by each move
+    unsigned char pieceDestinations[NUM_MOVES][26];
+    unsigned char edgeDestinations[NUM_MOVES][24];
+    unsigned char cornerDestinations[NUM_MOVES][24];
+    for (int m = 0; m < NUM_MOVES; m++)
+    {
+        for (int i = 0; i < 26; i++)
         {
-            turnMSlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            pieceDestinations[m][moveTables[m].pieces[i]] = i;
         }
-        else if (target == 17)
+        for (int i = 0; i < 24; i++)
         {
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            edgeDestinations[m][moveTables[m].edgeStickers[i]] = i;
+            cornerDestinations[m][moveTables[m].cornerStickers[i]] = i;
         }
-        else if (target == 18)
+    }
+
+    // find stickers of every slot by following the RU edge and the LUB corner through every move
+    bool edgeFound[12] = { false };
+    bool cornerFound[8] = { false };
+    edgeSlotStickers[15 - 6][0] = 1;
+    edgeSlotStickers[15 - 6][1] = 12;
+    edgeFound[15 - 6] = true;
+    cornerSlotStickers[18 - 18][0] = 0;
+    cornerSlotStickers[18 - 18][1] = 4;
+    cornerSlotStickers[18 - 18][2] = 17;
+    cornerFound[18 - 18] = true;
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (int m = 0; m < NUM_MOVES; m++)
         {
-            turnMSlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            for (int i = 0; i < 12; i++)
+            {
+                int slot = pieceDestinations[m][i + 6] - 6;
+                if (edgeFound[i] && !edgeFound[slot])
+                {
+                    for (int j = 0; j < 2; j++)
+                    {
+                        edgeSlotStickers[slot][j] = edgeDestinations[m][edgeSlotStickers[i][j]];
+                    }
+                    edgeFound[slot] = true;
+                    changed = true;
+                }
+            }
+            for (int i = 0; i < 8; i++)
+            {
+                int slot = pieceDestinations[m][i + 18] - 18;
+                if (cornerFound[i] && !cornerFound[slot])
+                {
+                    for (int j = 0; j < 3; j++)
+                    {
+                        cornerSlotStickers[slot][j] = cornerDestinations[m][cornerSlotStickers[i][j]];
+                    }
+                    cornerFound[slot] = true;
+                    changed = true;
+                }
+            }
         }
-        else if (target == 19)
+    }
+
+    // start every slot at its reference sticker, keeping the direction around the piece
+    for (int i = 0; i < 12; i++)
+    {
+        unsigned char* stickers = edgeSlotStickers[i];
+        if (!isUDSticker(stickers[0]) && (isUDSticker(stickers[1]) || isFBSticker(stickers[1])))
         {
-            turnESlice(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            swap(stickers[0], stickers[1]);
         }
-        else if (target == 20)
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        unsigned char* stickers = cornerSlotStickers[i];
+        while (!isUDSticker(stickers[0]))
         {
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            unsigned char first = stickers[0];
+            stickers[0] = stickers[1];
+            stickers[1] = stickers[2];
+            stickers[2] = first;
         }
-        else if (target == 21)
+    }
+
+    // save slot and orientation of each sticker
+    for (int i = 0; i < 12; i++)
+    {
+        for (int j = 0; j < 2; j++)
         {
-            turnDFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            edgeStickerCodes[edgeSlotStickers[i][j]] = i | j << 4;
         }
-        else if (target == 22)
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        for (int j = 0; j < 3; j++)
         {
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            cornerStickerCodes[cornerSlotStickers[i][j]] = i | j << 4;
         }
-        else if (target == 23)
+    }
+
+    // build shuffle and orientation masks, unused bytes keep their place
+    for (int m = 0; m < NUM_MOVES; m++)
+    {
+        PackedMove& packedMove = packedMoves[m];
+        for (int i = 0; i < 16; i++)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            packedMove.edgeShuffle[i] = i;
+            packedMove.edgeFlip[i] = 0;
+            packedMove.cornerShuffle[i] = i;
+            packedMove.cornerTwist[i] = 0;
         }
-        // perform edge swap algorithm
-        edgeSwap(window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
-        // undo moves that were performed to move piece into setup position
-        if (target == 0)
+        // the reference sticker of a slot is gathered from some sticker of another slot, which gives the orientation change
+        for (int i = 0; i < 12; i++)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnMSlice(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            unsigned char code = edgeStickerCodes[moveTables[m].edgeStickers[edgeSlotStickers[i][0]]];
+            packedMove.edgeShuffle[i] = code & 15;
+            packedMove.edgeFlip[i] = code & 0xF0;
         }
-        else if (target == 2)
+        for (int i = 0; i < 8; i++)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnMSlice(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            unsigned char code = cornerStickerCodes[moveTables[m].cornerStickers[cornerSlotStickers[i][0]]];
+            packedMove.cornerShuffle[i] = code & 15;
+            packedMove.cornerTwist[i] = code & 0xF0;
         }
-        else if (target == 4)
+        for (int i = 0; i < 6; i++)
         {
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            packedMove.cornerShuffle[i + 8] = moveTables[m].pieces[i] + 8;
         }
-        else if (target == 5)
+    }
+
+    // save solved packed cube
+    for (int i = 0; i < 16; i++)
+    {
+        solvedPackedCube.edges[i] = i;
+        solvedPackedCube.corners[i] = i < 8 ? i : i < 14 ? i - 8 : i;
+    }
+}
+
+// convert cube state to packed cube
+PackedCube packCube(const CubeState& cube)
+{
+    PackedCube packed = solvedPackedCube;
+    for (int i = 0; i < 12; i++)
+    {
+        packed.edges[i] = edgeStickerCodes[cube.edgeStickers[edgeSlotStickers[i][0]]];
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        packed.corners[i] = cornerStickerCodes[cube.cornerStickers[cornerSlotStickers[i][0]]];
+    }
+    for (int i = 0; i < 6; i++)
+    {
+        packed.corners[i + 8] = cube.pieces[i];
+    }
+    return packed;
+}
+
+// convert packed cube to cube state
+void unpackCube(const PackedCube& packed, CubeState& cube)
+{
+    for (int i = 0; i < 12; i++)
+    {
+        int piece = packed.edges[i] & 15;
+        int orientation = packed.edges[i] >> 4;
+        cube.pieces[i + 6] = piece + 6;
+        for (int j = 0; j < 2; j++)
         {
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            cube.edgeStickers[edgeSlotStickers[i][j]] = edgeSlotStickers[piece][(orientation + j) % 2];
         }
-        else if (target == 6)
+    }
+    for (int i = 0; i < 8; i++)
+    {
+        int piece = packed.corners[i] & 15;
+        int orientation = packed.corners[i] >> 4;
+        cube.pieces[i + 18] = piece + 18;
+        for (int j = 0; j < 3; j++)
         {
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            cube.cornerStickers[cornerSlotStickers[i][j]] = cornerSlotStickers[piece][(orientation + j) % 3];
         }
-        else if (target == 7)
+    }
+    for (int i = 0; i < 6; i++)
+    {
+        cube.pieces[i] = packed.corners[i + 8];
+    }
+}
+
+// make a move on a packed cube one byte at a time
+inline void applyPackedMoveScalar(PackedCube& cube, Move move)
+{
+    const PackedMove& packedMove = packedMoves[move];
+    PackedCube old = cube;
+    for (int i = 0; i < 16; i++)
+    {
+        cube.edges[i] = old.edges[packedMove.edgeShuffle[i]] ^ packedMove.edgeFlip[i];
+        int corner = old.corners[packedMove.cornerShuffle[i]] + packedMove.cornerTwist[i];
+        cube.corners[i] = corner >= 0x30 ? corner - 0x30 : corner;
+    }
+}
+
+// check if a packed cube is solved one byte at a time
+inline bool isPackedSolvedScalar(const PackedCube& cube)
+{
+    return memcmp(&cube, &solvedPackedCube, sizeof(PackedCube)) == 0;
+}
+
+#ifdef PACKED_CUBE_SIMD
+// make a move on a packed cube with one shuffle per vector
+inline void applyPackedMove(PackedCube& cube, Move move)
+{
+    const PackedMove& packedMove = packedMoves[move];
+    __m128i edges = _mm_load_si128((const __m128i*)cube.edges);
+    __m128i corners = _mm_load_si128((const __m128i*)cube.corners);
+    // shuffle pieces into their new slots and flip edges
+    edges = _mm_shuffle_epi8(edges, _mm_load_si128((const __m128i*)packedMove.edgeShuffle));
+    edges = _mm_xor_si128(edges, _mm_load_si128((const __m128i*)packedMove.edgeFlip));
+    // shuffle pieces into their new slots and twist corners, keeping twists below three
+    corners = _mm_shuffle_epi8(corners, _mm_load_si128((const __m128i*)packedMove.cornerShuffle));
+    corners = _mm_add_epi8(corners, _mm_load_si128((const __m128i*)packedMove.cornerTwist));
+    corners = _mm_min_epu8(corners, _mm_sub_epi8(corners, _mm_set1_epi8(0x30)));
+    _mm_store_si128((__m128i*)cube.edges, edges);
+    _mm_store_si128((__m128i*)cube.corners, corners);
+}
+
+// check if a packed cube is solved with one compare per vector
+inline bool isPackedSolved(const PackedCube& cube)
+{
+    __m128i edges = _mm_cmpeq_epi8(_mm_load_si128((const __m128i*)cube.edges), _mm_load_si128((const __m128i*)solvedPackedCube.edges));
+    __m128i corners = _mm_cmpeq_epi8(_mm_load_si128((const __m128i*)cube.corners), _mm_load_si128((const __m128i*)solvedPackedCube.corners));
+    return _mm_movemask_epi8(_mm_and_si128(edges, corners)) == 0xFFFF;
+}
+#else
+// make a move on a packed cube
+inline void applyPackedMove(PackedCube& cube, Move move)
+{
+    applyPackedMoveScalar(cube, move);
+}
+
+// check if a packed cube is solved
+inline bool isPackedSolved(const PackedCube& cube)
+{
+    return isPackedSolvedScalar(cube);
+}
+#endif
+
+// benchmark moves per second of cube states and packed cubes
+void benchmarkMoves()
+{
+    // generate random moves
+    const int SEQUENCE_LENGTH = 4096;
+    const int REPEATS = 5000;
+    Move moves[SEQUENCE_LENGTH];
+    for (int i = 0; i < SEQUENCE_LENGTH; i++)
+    {
+        moves[i] = randomGenerator.below(NUM_MOVES);
+    }
+    double totalMoves = (double)SEQUENCE_LENGTH * REPEATS;
+    int solvedCount = 0;
+
+    // cube state
+    CubeState cube;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int r = 0; r < REPEATS; r++)
+    {
+        for (int i = 0; i < SEQUENCE_LENGTH; i++)
         {
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            applyMove(cube, moves[i]);
         }
-        else if (target == 8)
+        solvedCount += isSolved("CUBE", cube);
+    }
+    double cubeSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // packed cube one byte at a time
+    PackedCube scalarCube = solvedPackedCube;
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < REPEATS; r++)
+    {
+        for (int i = 0; i < SEQUENCE_LENGTH; i++)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnMSlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            applyPackedMoveScalar(scalarCube, moves[i]);
         }
-        else if (target == 9)
+        solvedCount += isPackedSolvedScalar(scalarCube);
+    }
+    double scalarSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // packed cube with shuffles
+    PackedCube simdCube = solvedPackedCube;
+    start = chrono::steady_clock::now();
+    for (int r = 0; r < REPEATS; r++)
+    {
+        for (int i = 0; i < SEQUENCE_LENGTH; i++)
         {
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            applyPackedMove(simdCube, moves[i]);
         }
-        else if (target == 10)
+        solvedCount += isPackedSolved(simdCube);
+    }
+    double simdSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // check that all three agree
+    CubeState unpacked;
+    unpackCube(scalarCube, unpacked);
+    bool agree = memcmp(&scalarCube, &simdCube, sizeof(PackedCube)) == 0 && memcmp(unpacked.edgeStickers, cube.edgeStickers, 24) == 0 && memcmp(unpacked.cornerStickers, cube.cornerStickers, 24) == 0;
+
+    // display results
+    cout << "cube state:          " << totalMoves / cubeSeconds / 1e6 << " million moves per second" << endl;
+    cout << "packed cube, scalar: " << totalMoves / scalarSeconds / 1e6 << " million moves per second" << endl;
+#ifdef PACKED_CUBE_SIMD
+    cout << "packed cube, SIMD:   " << totalMoves / simdSeconds / 1e6 << " million moves per second" << endl;
+#else
+    cout << "packed cube, SIMD:   " << totalMoves / simdSeconds / 1e6 << " million moves per second (built without SSSE3, uses scalar fallback)" << endl;
+#endif
+    cout << (agree ? "results agree" : "ERROR::BENCHMARKMOVES::RESULTS_DIFFER") << " (" << solvedCount << " solved)" << endl;
+}
+
+// cube batch structure
+// holds 32 packed cubes as a structure of arrays, so each slot of all 32 cubes fills one 32 byte vector
+// a move only moves whole vectors between slots, so it is made on all 32 cubes at once
+struct CubeBatch
+{
+    alignas(32) unsigned char edges[12][32];
+    alignas(32) unsigned char corners[14][32];
+};
+
+// put packed cube into lane of batch
+void setBatchCube(CubeBatch& batch, int lane, const PackedCube& cube)
+{
+    for (int i = 0; i < 12; i++)
+    {
+        batch.edges[i][lane] = cube.edges[i];
+    }
+    for (int i = 0; i < 14; i++)
+    {
+        batch.corners[i][lane] = cube.corners[i];
+    }
+}
+
+// get packed cube from lane of batch
+PackedCube getBatchCube(const CubeBatch& batch, int lane)
+{
+    PackedCube cube = solvedPackedCube;
+    for (int i = 0; i < 12; i++)
+    {
+        cube.edges[i] = batch.edges[i][lane];
+    }
+    for (int i = 0; i < 14; i++)
+    {
+        cube.corners[i] = batch.corners[i][lane];
+    }
+    return cube;
+}
+
+#ifdef __AVX2__
+// make a move on every cube of a batch
+void applyBatchMove(CubeBatch& batch, Move move)
+{
+    const PackedMove& packedMove = packedMoves[move];
+    __m256i edges[12];
+    __m256i corners[14];
+    // gather slots, flipping edges
+    for (int i = 0; i < 12; i++)
+    {
+        __m256i flip = _mm256_set1_epi8(packedMove.edgeFlip[i]);
+        edges[i] = _mm256_xor_si256(_mm256_load_si256((const __m256i*)batch.edges[packedMove.edgeShuffle[i]]), flip);
+    }
+    // gather slots, twisting corners and keeping twists below three
+    for (int i = 0; i < 14; i++)
+    {
+        __m256i twist = _mm256_set1_epi8(packedMove.cornerTwist[i]);
+        __m256i corner = _mm256_add_epi8(_mm256_load_si256((const __m256i*)batch.corners[packedMove.cornerShuffle[i]]), twist);
+        corners[i] = _mm256_min_epu8(corner, _mm256_sub_epi8(corner, _mm256_set1_epi8(0x30)));
+    }
+    for (int i = 0; i < 12; i++)
+    {
+        _mm256_store_si256((__m256i*)batch.edges[i], edges[i]);
+    }
+    for (int i = 0; i < 14; i++)
+    {
+        _mm256_store_si256((__m256i*)batch.corners[i], corners[i]);
+    }
+}
+
+// get mask with a bit set for each solved cube of a batch
+unsigned int solvedBatchMask(const CubeBatch& batch)
+{
+    __m256i solved = _mm256_set1_epi8(-1);
+    for (int i = 0; i < 12; i++)
+    {
+        __m256i edge = _mm256_load_si256((const __m256i*)batch.edges[i]);
+        solved = _mm256_and_si256(solved, _mm256_cmpeq_epi8(edge, _mm256_set1_epi8(solvedPackedCube.edges[i])));
+    }
+    for (int i = 0; i < 14; i++)
+    {
+        __m256i corner = _mm256_load_si256((const __m256i*)batch.corners[i]);
+        solved = _mm256_and_si256(solved, _mm256_cmpeq_epi8(corner, _mm256_set1_epi8(solvedPackedCube.corners[i])));
+    }
+    return (unsigned int)_mm256_movemask_epi8(solved);
+}
+#else
+// make a move on every cube of a batch
+void applyBatchMove(CubeBatch& batch, Move move)
+{
+    const PackedMove& packedMove = packedMoves[move];
+    CubeBatch old = batch;
+    for (int i = 0; i < 12; i++)
+    {
+        for (int lane = 0; lane < 32; lane++)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnMSlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            batch.edges[i][lane] = old.edges[packedMove.edgeShuffle[i]][lane] ^ packedMove.edgeFlip[i];
         }
-        else if (target == 11)
+    }
+    for (int i = 0; i < 14; i++)
+    {
+        for (int lane = 0; lane < 32; lane++)
         {
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            int corner = old.corners[packedMove.cornerShuffle[i]][lane] + packedMove.cornerTwist[i];
+            batch.corners[i][lane] = corner >= 0x30 ? corner - 0x30 : corner;
         }
-        else if (target == 13)
+    }
+}
+
+// get mask with a bit set for each solved cube of a batch
+unsigned int solvedBatchMask(const CubeBatch& batch)
+{
+    unsigned int mask = 0;
+    for (int lane = 0; lane < 32; lane++)
+    {
+        PackedCube cube = getBatchCube(batch, lane);
+        if (isPackedSolved(cube))
         {
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            mask |= 1u << lane;
         }
-        else if (target == 14)
+    }
+    return mask;
+}
+#endif
+
+// make a sequence of moves on every cube of a batch
+void replayBatch(CubeBatch& batch, const Move* moves, int moveCount)
+{
+    for (int i = 0; i < moveCount; i++)
+    {
+        applyBatchMove(batch, moves[i]);
+    }
+}
+
+// count how many of the given cubes are solved by a sequence of moves, 32 cubes at a time
+int countSolvedBatch(const vector <PackedCube>& cubes, const vector <Move>& solution)
+{
+    int solved = 0;
+    for (int first = 0; first < (int)cubes.size(); first += 32)
+    {
+        // fill batch, repeating the last cube in unused lanes
+        CubeBatch batch;
+        int laneCount = min(32, (int)cubes.size() - first);
+        for (int lane = 0; lane < 32; lane++)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnMSlice(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            setBatchCube(batch, lane, cubes[first + min(lane, laneCount - 1)]);
         }
-        else if (target == 15)
+        replayBatch(batch, solution.data(), (int)solution.size());
+        unsigned int mask = solvedBatchMask(batch);
+        if (laneCount < 32)
         {
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            mask &= (1u << laneCount) - 1;
         }
-        else if (target == 16)
+        // count set bits
+        while (mask != 0)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnMSlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            mask &= mask - 1;
+            solved++;
         }
-        else if (target == 17)
+    }
+    return solved;
+}
+
+// benchmark moves per second of cube batches
+void benchmarkBatch()
+{
+    // scramble cubes with the scrambler, then check the undo sequence of one scramble against all of them
+    const int CUBE_COUNT = 32 * 4096;
+    const int REPEATS = 20;
+    vector <PackedCube> cubes(CUBE_COUNT);
+    Move scramble[25];
+    for (int i = 0; i < CUBE_COUNT; i++)
+    {
+        generateScramble(randomGenerator, scramble, 25);
+        PackedCube cube = solvedPackedCube;
+        for (int j = 0; j < 25; j++)
         {
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            applyPackedMove(cube, scramble[j]);
         }
-        else if (target == 18)
+        cubes[i] = cube;
+    }
+    // undo the last scramble, which must solve exactly the cubes that got the same scramble
+    vector <Move> solution;
+    for (int j = 24; j >= 0; j--)
+    {
+        solution.push_back(inverseMove(scramble[j]));
+    }
+
+    // time batches
+    int solved = 0;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int r = 0; r < REPEATS; r++)
+    {
+        solved = countSolvedBatch(cubes, solution);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // check against one packed cube at a time
+    int expected = 0;
+    for (int i = 0; i < CUBE_COUNT; i++)
+    {
+        PackedCube cube = cubes[i];
+        for (int j = 0; j < (int)solution.size(); j++)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnMSlice(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            applyPackedMove(cube, solution[j]);
         }
-        else if (target == 19)
+        expected += isPackedSolved(cube);
+    }
+
+    // display results
+    double checks = (double)CUBE_COUNT * REPEATS;
+    cout << "cube batch: " << checks * solution.size() / seconds / 1e6 << " million cube moves per second, ";
+    cout << checks / seconds / 1e6 << " million solution checks per second" << endl;
+    cout << (solved == expected && solved >= 1 ? "results agree" : "ERROR::BENCHMARKBATCH::RESULTS_DIFFER") << " (" << solved << " solved)" << endl;
+}
+
+// two-phase solver
+// phase 1 moves the cube into the group generated by U, D, L2, R2, F2 and B2, where every piece is oriented and
+// the E slice edges are in the E slice, and phase 2 solves the cube using only those moves
+// both phases are searched with iterative deepening on coordinates, using move tables and pruning tables
+
+// declare sizes of coordinates
+const int TWIST_COUNT = 2187; // orientations of corners
+const int FLIP_COUNT = 2048; // orientations of edges
+const int SLICE_COUNT = 495; // positions of the E slice edges
+const int CORNER_PERM_COUNT = 40320; // permutations of corners
+const int EDGE_PERM_COUNT = 40320; // permutations of U and D edges
+const int SLICE_PERM_COUNT = 24; // permutations of E slice edges
+const int SOLVED_SLICE = 494;
+
+// declare order of edge slots used by the two-phase solver, with the E slice edges last, and its inverse
+const int twoPhaseEdgeSlots[12] = { 0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7 };
+const int twoPhaseEdgeIndex[12] = { 0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7 };
+
+// declare face moves
+const Move faceMoves[18] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 };
+
+// declare moves allowed in phase 2
+const int PHASE_2_MOVE_COUNT = 10;
+const Move phase2Moves[PHASE_2_MOVE_COUNT] = { 0, 1, 2, 3, 4, 5, 7, 10, 13, 16 };
+
+// declare move tables
+unsigned short twistMoves[TWIST_COUNT * 18];
+unsigned short flipMoves[FLIP_COUNT * 18];
+unsigned short sliceMoves[SLICE_COUNT * 18];
+unsigned short cornerPermMoves[CORNER_PERM_COUNT * PHASE_2_MOVE_COUNT];
+unsigned short edgePermMoves[EDGE_PERM_COUNT * PHASE_2_MOVE_COUNT];
+unsigned short slicePermMoves[SLICE_PERM_COUNT * PHASE_2_MOVE_COUNT];
+
+// declare pruning tables, which hold the number of moves needed to solve a pair of coordinates
+unsigned char twistSlicePrune[TWIST_COUNT * SLICE_COUNT];
+unsigned char flipSlicePrune[FLIP_COUNT * SLICE_COUNT];
+unsigned char cornerSlicePrune[CORNER_PERM_COUNT * SLICE_PERM_COUNT];
+unsigned char edgeSlicePrune[EDGE_PERM_COUNT * SLICE_PERM_COUNT];
+
+// get binomial coefficient
+int binomial(int n, int k)
+{
+    if (k > n)
+    {
+        return 0;
+    }
+    int result = 1;
+    for (int i = 1; i <= k; i++)
+    {
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+// get rank of a permutation of 0 to n - 1
+int rankPermutation(const int* permutation, int n)
+{
+    int rank = 0;
+    for (int i = 0; i < n; i++)
+    {
+        // count later elements that are smaller
+        int smaller = 0;
+        for (int j = i + 1; j < n; j++)
         {
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnESlice(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            if (permutation[j] < permutation[i])
+            {
+                smaller++;
+            }
         }
-        else if (target == 20)
+        rank = rank * (n - i) + smaller;
+    }
+    return rank;
+}
+
+// get permutation of 0 to n - 1 from its rank
+void unrankPermutation(int rank, int* permutation, int n)
+{
+    int smaller[12];
+    for (int i = n - 1; i >= 0; i--)
+    {
+        smaller[i] = rank % (n - i);
+        rank /= n - i;
+    }
+    int remaining[12];
+    for (int i = 0; i < n; i++)
+    {
+        remaining[i] = i;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        permutation[i] = remaining[smaller[i]];
+        for (int j = smaller[i]; j < n - i - 1; j++)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            remaining[j] = remaining[j + 1];
         }
-        else if (target == 21)
+    }
+}
+
+// get piece in an edge slot, in the order used by the two-phase solver
+inline int getTwoPhaseEdge(const PackedCube& cube, int i)
+{
+    return twoPhaseEdgeIndex[cube.edges[twoPhaseEdgeSlots[i]] & 15];
+}
+
+// put piece into an edge slot, in the order used by the two-phase solver
+inline void setTwoPhaseEdge(PackedCube& cube, int i, int piece)
+{
+    cube.edges[twoPhaseEdgeSlots[i]] = (cube.edges[twoPhaseEdgeSlots[i]] & 0xF0) | twoPhaseEdgeSlots[piece];
+}
+
+// get orientation of corners
+int getTwist(const PackedCube& cube)
+{
+    int twist = 0;
+    for (int i = 0; i < 7; i++)
+    {
+        twist = 3 * twist + (cube.corners[i] >> 4);
+    }
+    return twist;
+}
+
+// set orientation of corners, the last corner is fixed by the others
+void setTwist(PackedCube& cube, int twist)
+{
+    int sum = 0;
+    for (int i = 6; i >= 0; i--)
+    {
+        cube.corners[i] = (cube.corners[i] & 15) | (twist % 3) << 4;
+        sum += twist % 3;
+        twist /= 3;
+    }
+    cube.corners[7] = (cube.corners[7] & 15) | ((3 - sum % 3) % 3) << 4;
+}
+
+// get orientation of edges
+int getFlip(const PackedCube& cube)
+{
+    int flip = 0;
+    for (int i = 0; i < 11; i++)
+    {
+        flip = 2 * flip + (cube.edges[twoPhaseEdgeSlots[i]] >> 4);
+    }
+    return flip;
+}
+
+// set orientation of edges, the last edge is fixed by the others
+void setFlip(PackedCube& cube, int flip)
+{
+    int sum = 0;
+    for (int i = 10; i >= 0; i--)
+    {
+        cube.edges[twoPhaseEdgeSlots[i]] = (cube.edges[twoPhaseEdgeSlots[i]] & 15) | (flip % 2) << 4;
+        sum += flip % 2;
+        flip /= 2;
+    }
+    cube.edges[twoPhaseEdgeSlots[11]] = (cube.edges[twoPhaseEdgeSlots[11]] & 15) | (sum % 2) << 4;
+}
+
+// get slots of E slice edges, ignoring their order
+int getSlice(const PackedCube& cube)
+{
+    int slice = 0;
+    int found = 0;
+    for (int i = 0; i < 12; i++)
+    {
+        if (getTwoPhaseEdge(cube, i) >= 8)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            found++;
+            slice += binomial(i, found);
         }
-        else if (target == 22)
+    }
+    return slice;
+}
+
+// set slots of E slice edges
+void setSlice(PackedCube& cube, int slice)
+{
+    // find slots of E slice edges
+    bool isSliceSlot[12] = { false };
+    for (int k = 4; k >= 1; k--)
+    {
+        int slot = k - 1;
+        while (binomial(slot + 1, k) <= slice)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            slot++;
         }
-        else if (target == 23)
+        isSliceSlot[slot] = true;
+        slice -= binomial(slot, k);
+    }
+    // fill slots
+    int slicePiece = 8;
+    int otherPiece = 0;
+    for (int i = 0; i < 12; i++)
+    {
+        setTwoPhaseEdge(cube, i, isSliceSlot[i] ? slicePiece++ : otherPiece++);
+    }
+}
+
+// get permutation of corners
+int getCornerPerm(const PackedCube& cube)
+{
+    int permutation[8];
+    for (int i = 0; i < 8; i++)
+    {
+        permutation[i] = cube.corners[i] & 15;
+    }
+    return rankPermutation(permutation, 8);
+}
+
+// set permutation of corners
+void setCornerPerm(PackedCube& cube, int cornerPerm)
+{
+    int permutation[8];
+    unrankPermutation(cornerPerm, permutation, 8);
+    for (int i = 0; i < 8; i++)
+    {
+        cube.corners[i] = (cube.corners[i] & 0xF0) | permutation[i];
+    }
+}
+
+// get permutation of U and D edges, only meaningful in phase 2
+int getEdgePerm(const PackedCube& cube)
+{
+    int permutation[8];
+    for (int i = 0; i < 8; i++)
+    {
+        permutation[i] = getTwoPhaseEdge(cube, i);
+    }
+    return rankPermutation(permutation, 8);
+}
+
+// set permutation of U and D edges
+void setEdgePerm(PackedCube& cube, int edgePerm)
+{
+    int permutation[8];
+    unrankPermutation(edgePerm, permutation, 8);
+    for (int i = 0; i < 8; i++)
+    {
+        setTwoPhaseEdge(cube, i, permutation[i]);
+    }
+}
+
+// get permutation of E slice edges, only meaningful in phase 2
+int getSlicePerm(const PackedCube& cube)
+{
+    int permutation[4];
+    for (int i = 0; i < 4; i++)
+    {
+        permutation[i] = getTwoPhaseEdge(cube, i + 8) - 8;
+    }
+    return rankPermutation(permutation, 4);
+}
+
+// set permutation of E slice edges
+void setSlicePerm(PackedCube& cube, int slicePerm)
+{
+    int permutation[4];
+    unrankPermutation(slicePerm, permutation, 4);
+    for (int i = 0; i < 4; i++)
+    {
+        setTwoPhaseEdge(cube, i + 8, permutation[i] + 8);
+    }
+}
+
+// fill move table of a coordinate by making each move on a cube with each value of the coordinate
+void initCoordinateMoves(unsigned short* table, int count, const Move* moves, int moveCount, void (*setCoordinate)(PackedCube&, int), int (*getCoordinate)(const PackedCube&))
+{
+    for (int i = 0; i < count; i++)
+    {
+        PackedCube cube = solvedPackedCube;
+        setCoordinate(cube, i);
+        for (int j = 0; j < moveCount; j++)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            PackedCube moved = cube;
+            applyPackedMove(moved, moves[j]);
+            table[i * moveCount + j] = getCoordinate(moved);
         }
-        // solve next edge piece
-        solveEdges(window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
     }
 }
 
-// solve corners
-void solveCorners(GLFWwindow* window, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26], Cube* cubes, GLuint core_program, glm::mat4 proj, glm::mat4 view)
+// fill pruning table of a pair of coordinates with a breadth first search from the solved pair
+// pairs that cannot be reached keep the value 255
+void initPruneTable(unsigned char* table, int count1, const unsigned short* moves1, int count2, const unsigned short* moves2, int moveCount, int solved1, int solved2)
 {
-    // check if corners are already solved
-    if (isSolved("CORNERS", pieces, edgeStickers, cornerStickers) == false)
+    memset(table, 255, count1 * count2);
+    table[solved1 * count2 + solved2] = 0;
+    int added = 1;
+    for (int depth = 0; added > 0; depth++)
     {
-        int target;
-        // find target piece if corner buffer piece is in buffer position
-        if (pieces[18] == 18)
+        added = 0;
+        for (int i = 0; i < count1 * count2; i++)
         {
-            // choose an unsolved piece as target
-            for (int i = 0; i < 24; i++)
+            if (table[i] == depth)
             {
-                if (cornerStickers[i] != i && i != 0 && i != 4 && i != 17)
+                int coordinate1 = i / count2;
+                int coordinate2 = i % count2;
+                for (int j = 0; j < moveCount; j++)
                 {
-                    target = i;
-                    break;
+                    int next = moves1[coordinate1 * moveCount + j] * count2 + moves2[coordinate2 * moveCount + j];
+                    if (table[next] == 255)
+                    {
+                        table[next] = depth + 1;
+                        added++;
+                    }
                 }
             }
         }
-        // find target piece if corner buffer piece is not in buffer position
-        else
-        {
-            // find target piece
-            target = cornerStickers[4];
-        }
-        // move target piece into setup position
-        if (target == 1)
+    }
+}
+
+// generate move tables and pruning tables of the two-phase solver the first time they are needed
+void initTwoPhaseTables()
+{
+    static bool initialized = false;
+    if (initialized)
+    {
+        return;
+    }
+    initialized = true;
+
+    // move tables
+    initCoordinateMoves(twistMoves, TWIST_COUNT, faceMoves, 18, setTwist, getTwist);
+    initCoordinateMoves(flipMoves, FLIP_COUNT, faceMoves, 18, setFlip, getFlip);
+    initCoordinateMoves(sliceMoves, SLICE_COUNT, faceMoves, 18, setSlice, getSlice);
+    initCoordinateMoves(cornerPermMoves, CORNER_PERM_COUNT, phase2Moves, PHASE_2_MOVE_COUNT, setCornerPerm, getCornerPerm);
+    initCoordinateMoves(edgePermMoves, EDGE_PERM_COUNT, phase2Moves, PHASE_2_MOVE_COUNT, setEdgePerm, getEdgePerm);
+    initCoordinateMoves(slicePermMoves, SLICE_PERM_COUNT, phase2Moves, PHASE_2_MOVE_COUNT, setSlicePerm, getSlicePerm);
+
+    // pruning tables
+    initPruneTable(twistSlicePrune, TWIST_COUNT, twistMoves, SLICE_COUNT, sliceMoves, 18, 0, SOLVED_SLICE);
+    initPruneTable(flipSlicePrune, FLIP_COUNT, flipMoves, SLICE_COUNT, sliceMoves, 18, 0, SOLVED_SLICE);
+    initPruneTable(cornerSlicePrune, CORNER_PERM_COUNT, cornerPermMoves, SLICE_PERM_COUNT, slicePermMoves, PHASE_2_MOVE_COUNT, 0, 0);
+    initPruneTable(edgeSlicePrune, EDGE_PERM_COUNT, edgePermMoves, SLICE_PERM_COUNT, slicePermMoves, PHASE_2_MOVE_COUNT, 0, 0);
+}
+
+// check if two faces can follow each other, which rules out repeated faces and one order of opposite faces
+inline bool canFollow(int lastFace, int face)
+{
+    return lastFace < 0 || (face != lastFace && !(face / 2 == lastFace / 2 && face < lastFace));
+}
+
+// two-phase search class
+class TwoPhaseSearch
+{
+private:
+    // declare variables
+    PackedCube start;
+    Move moves[32];
+    vector <Move> best;
+    int maxLength;
+    int targetLength;
+    chrono::steady_clock::time_point deadline;
+    long long nodes;
+    bool stopped;
+
+    // check if search should stop
+    bool shouldStop()
+    {
+        // only stop for time once a solution is known, checking the clock every few thousand nodes
+        if (!stopped && !best.empty() && (++nodes & 4095) == 0 && chrono::steady_clock::now() > deadline)
         {
-            turnRFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            stopped = true;
         }
-        else if (target == 2)
+        return stopped;
+    }
+
+    // search phase 2 to the given depth
+    bool searchPhase2(int cornerPerm, int edgePerm, int slicePerm, int depth, int togo, int lastFace)
+    {
+        if (togo == 0)
         {
-            turnFFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            return cornerPerm == 0 && edgePerm == 0 && slicePerm == 0;
         }
-        else if (target == 3)
+        for (int i = 0; i < PHASE_2_MOVE_COUNT; i++)
         {
-            turnFFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            int face = phase2Moves[i] / 3;
+            if (!canFollow(lastFace, face))
+            {
+                continue;
+            }
+            int nextCornerPerm = cornerPermMoves[cornerPerm * PHASE_2_MOVE_COUNT + i];
+            int nextEdgePerm = edgePermMoves[edgePerm * PHASE_2_MOVE_COUNT + i];
+            int nextSlicePerm = slicePermMoves[slicePerm * PHASE_2_MOVE_COUNT + i];
+            int distance = max(cornerSlicePrune[nextCornerPerm * SLICE_PERM_COUNT + nextSlicePerm], edgeSlicePrune[nextEdgePerm * SLICE_PERM_COUNT + nextSlicePerm]);
+            if (distance >= togo)
+            {
+                continue;
+            }
+            moves[depth] = phase2Moves[i];
+            if (searchPhase2(nextCornerPerm, nextEdgePerm, nextSlicePerm, depth + 1, togo - 1, face))
+            {
+                return true;
+            }
         }
-        else if (target == 5)
+        return false;
+    }
+
+    // start phase 2 after a phase 1 solution of the given length
+    bool startPhase2(int length)
+    {
+        // make phase 1 moves on the cube to find the phase 2 coordinates
+        PackedCube cube = start;
+        for (int i = 0; i < length; i++)
         {
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            applyPackedMove(cube, moves[i]);
         }
-        else if (target == 6)
+        int cornerPerm = getCornerPerm(cube);
+        int edgePerm = getEdgePerm(cube);
+        int slicePerm = getSlicePerm(cube);
+        int lastFace = length > 0 ? moves[length - 1] / 3 : -1;
+
+        // search phase 2 with increasing depth, stopping short of the best solution so far
+        int distance = max(cornerSlicePrune[cornerPerm * SLICE_PERM_COUNT + slicePerm], edgeSlicePrune[edgePerm * SLICE_PERM_COUNT + slicePerm]);
+        for (int depth = distance; length + depth <= maxLength && depth <= 18; depth++)
         {
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            if (searchPhase2(cornerPerm, edgePerm, slicePerm, length, depth, lastFace))
+            {
+                // save solution
+                best.assign(moves, moves + length + depth);
+                maxLength = length + depth - 1;
+                return (int)best.size() <= targetLength;
+            }
         }
-        else if (target == 7)
+        return false;
+    }
+
+    // search phase 1 to the given depth
+    bool searchPhase1(int twist, int flip, int slice, int depth, int togo, int lastFace)
+    {
+        if (shouldStop())
         {
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            return true;
         }
-        else if (target == 8)
+        if (togo == 0)
         {
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            // a phase 1 solution ending in a phase 2 move was already found as a shorter one
+            if (twist != 0 || flip != 0 || slice != SOLVED_SLICE)
+            {
+                return false;
+            }
+            if (depth > 0)
+            {
+                int degree = moves[depth - 1] % 3 + 1;
+                if (lastFace <= D_FACE || degree == 2)
+                {
+                    return false;
+                }
+            }
+            return startPhase2(depth);
         }
-        else if (target == 9)
+        for (int move = 0; move < 18; move++)
         {
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 10)
-        {
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 11)
-        {
-            turnFFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 12)
-        {
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 13)
-        {
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 14)
-        {
-            turnRFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 15)
-        {
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 16)
-        {
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 18)
-        {
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 19)
-        {
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 20)
-        {
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 22)
-        {
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 23)
-        {
-            turnDFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        // perform corner swap algorithm
-        cornerSwap(window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
-        // undo moves that were performed to move piece into setup position
-        if (target == 1)
-        {
-            turnRFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 2)
-        {
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnFFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 3)
-        {
-            turnFFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 5)
-        {
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 6)
-        {
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 7)
-        {
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 8)
-        {
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 9)
-        {
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 10)
-        {
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 11)
-        {
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnFFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 12)
-        {
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 13)
-        {
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 14)
-        {
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnRFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 15)
-        {
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 16)
-        {
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 18)
-        {
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 19)
-        {
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
-        }
-        else if (target == 20)
-        {
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+            int face = move / 3;
+            if (!canFollow(lastFace, face))
+            {
+                continue;
+            }
+            int nextTwist = twistMoves[twist * 18 + move];
+            int nextFlip = flipMoves[flip * 18 + move];
+            int nextSlice = sliceMoves[slice * 18 + move];
+            int distance = max(twistSlicePrune[nextTwist * SLICE_COUNT + nextSlice], flipSlicePrune[nextFlip * SLICE_COUNT + nextSlice]);
+            if (distance >= togo)
+            {
+                continue;
+            }
+            moves[depth] = move;
+            if (searchPhase1(nextTwist, nextFlip, nextSlice, depth + 1, togo - 1, face))
+            {
+                return true;
+            }
         }
-        else if (target == 22)
-        {
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+        return false;
+    }
+public:
+    // find a solution of at most targetLength moves, or the shortest one found within timeLimit seconds
+    vector <Move> solve(const PackedCube& cube, int target, double timeLimit)
+    {
+        initTwoPhaseTables();
+        start = cube;
+        best.clear();
+        maxLength = 30;
+        targetLength = target;
+        deadline = chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(timeLimit));
+        nodes = 0;
+        stopped = false;
+        if (isPackedSolved(cube))
+        {
+            return best;
         }
-        else if (target == 23)
-        {
-            turnDFace(2, pieces, edgeStickers, cornerStickers, rotation);
-            renderCubes(window, cubes, core_program, proj, view, rotation);
-            delay(0.2);
+
+        // search phase 1 with increasing depth
+        int twist = getTwist(cube);
+        int flip = getFlip(cube);
+        int slice = getSlice(cube);
+        int distance = max(twistSlicePrune[twist * SLICE_COUNT + slice], flipSlicePrune[flip * SLICE_COUNT + slice]);
+        for (int depth = distance; depth <= maxLength; depth++)
+        {
+            if (searchPhase1(twist, flip, slice, 0, depth, -1))
+            {
+                break;
+            }
         }
-        // solve next corner piece
-        solveCorners(window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
+        return best;
     }
+};
+
+// optimal solver
+// searches with iterative deepening on the 18 face moves, bounded by pattern databases holding the number of moves
+// needed to solve the corners, the first six edges and the last six edges, so the first solution found is optimal
+// a move changes each of those numbers by at most one, so pattern databases only store them modulo 3, four entries
+// per byte, and the search keeps the exact numbers of each node to find those of its children
+
+// declare sizes of pattern databases
+const int CORNER_PATTERN_COUNT = CORNER_PERM_COUNT * TWIST_COUNT;
+const int EDGE_PATTERN_COUNT = 665280 * 64; // positions of six edges times their orientations
+
+// declare move tables
+unsigned short fullCornerPermMoves[CORNER_PERM_COUNT * 18];
+unsigned char edgePositionMoves[18][24]; // where each move sends an edge in a slot with an orientation, stored as 2 * slot + flip
+
+// declare number of slots in each set of edge slots
+unsigned char slotCounts[4096];
+
+// declare pattern databases
+vector <unsigned char> cornerPatterns;
+vector <unsigned char> firstEdgePatterns;
+vector <unsigned char> lastEdgePatterns;
+
+// get entry of pattern database
+inline int getPattern(const unsigned char* patterns, int index)
+{
+    return (patterns[index >> 2] >> ((index & 3) << 1)) & 3;
 }
 
-// solve cube
-void solveCube(GLFWwindow* window, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26], Cube* cubes, GLuint core_program, glm::mat4 proj, glm::mat4 view)
+// get number of moves to solve a child from that of its parent and the pattern database entry of the child
+inline int getChildDistance(int distance, int pattern)
 {
-    // check if cube is already solved
-    if (isSolved("CUBE", pieces, edgeStickers, cornerStickers) == false)
+    return distance + (pattern - distance % 3 + 4) % 3 - 1;
+}
+
+// start loading an entry of a pattern database into the cache before it is needed
+inline void prefetchPattern(const unsigned char* patterns, int index)
+{
+#ifdef PACKED_CUBE_SIMD
+    _mm_prefetch((const char*)patterns + (index >> 2), _MM_HINT_T0);
+#else
+    (void)patterns;
+    (void)index;
+#endif
+}
+
+// get index of six edges in an edge pattern database from their positions
+inline int getEdgePatternIndex(const unsigned char* positions)
+{
+    int rank = 0;
+    int flips = 0;
+    int taken = 0;
+    for (int i = 0; i < 6; i++)
     {
-        // orient cube so that green face is at front and white face is on top
-        orientCube(2, 0, window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
-        // solve edges
-        solveEdges(window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
-        // check if parity has occured
-        int unsolvedCorners = 0;
-        for (int i = 18; i < 26; i++)
+        // skip slots taken by earlier edges that come before this one
+        int slot = positions[i] >> 1;
+        rank = rank * (12 - i) + slot - slotCounts[taken & ((1 << slot) - 1)];
+        taken |= 1 << slot;
+        flips = 2 * flips + (positions[i] & 1);
+    }
+    return rank * 64 + flips;
+}
+
+// get positions of six edges from their index in an edge pattern database
+void setEdgePatternIndex(unsigned char* positions, int index)
+{
+    int flips = index % 64;
+    int rank = index / 64;
+    int digits[6];
+    for (int i = 5; i >= 0; i--)
+    {
+        digits[i] = rank % (12 - i);
+        rank /= 12 - i;
+    }
+    bool taken[12] = { false };
+    for (int i = 0; i < 6; i++)
+    {
+        // find the free slot with the given number of free slots before it
+        int slot = 0;
+        for (int free = 0; taken[slot] || free < digits[i]; slot++)
         {
-            if (pieces[i] != i)
+            if (!taken[slot])
             {
-                unsolvedCorners++;
+                free++;
             }
         }
-        // perform parity algorithm if needed
-        if (unsolvedCorners % 2 == 1)
-        {
-            parity(window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
-        }
-        // solve corners
-        solveCorners(window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
+        taken[slot] = true;
+        positions[i] = 2 * slot + (flips >> (5 - i) & 1);
     }
 }
 
-// scramble cube
-void scrambleCube(int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26])
+// get entry of a table holding two entries per byte, used to generate pattern databases
+inline int getNibble(const unsigned char* table, int index)
+{
+    return (table[index >> 1] >> ((index & 1) << 2)) & 15;
+}
+
+// set entry of a table holding two entries per byte
+inline void setNibble(unsigned char* table, int index, int value)
+{
+    int shift = (index & 1) << 2;
+    table[index >> 1] = (table[index >> 1] & ~(15 << shift)) | value << shift;
+}
+
+// store distances modulo 3 in a pattern database
+void packPatterns(const vector <unsigned char>& distances, int count, vector <unsigned char>& patterns)
 {
-    // randomly generate moves
-    vector <int> moves;
-    for (int i = 0; i < 25; i++)
+    patterns.assign(count / 4, 0);
+    for (int i = 0; i < count; i++)
     {
-        moves.push_back(rand() % 18 + 1);
+        patterns[i >> 2] |= getNibble(distances.data(), i) % 3 << ((i & 3) << 1);
     }
+}
 
-    // perform randomly generated moves
-    for (int i = 0; i < 25; i++)
+// fill corner pattern database with a breadth first search from the solved corners
+void initCornerPatterns()
+{
+    vector <unsigned char> distances(CORNER_PATTERN_COUNT / 2, 255);
+    setNibble(distances.data(), 0, 0);
+    int filled = 1;
+    for (int depth = 0; filled < CORNER_PATTERN_COUNT; depth++)
     {
-        if (moves[i] == 1)
-        {
-            turnUFace(1, pieces, edgeStickers, cornerStickers, rotation);
-        }
-        else if (moves[i] == 2)
-        {
-            turnUFace(2, pieces, edgeStickers, cornerStickers, rotation);
-        }
-        else if (moves[i] == 3)
+        for (int i = 0; i < CORNER_PATTERN_COUNT; i++)
         {
-            turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
+            if (getNibble(distances.data(), i) == depth)
+            {
+                int cornerPerm = i / TWIST_COUNT;
+                int twist = i % TWIST_COUNT;
+                for (int move = 0; move < 18; move++)
+                {
+                    int next = fullCornerPermMoves[cornerPerm * 18 + move] * TWIST_COUNT + twistMoves[twist * 18 + move];
+                    if (getNibble(distances.data(), next) == 15)
+                    {
+                        setNibble(distances.data(), next, depth + 1);
+                        filled++;
+                    }
+                }
+            }
         }
-        else if (moves[i] == 4)
+    }
+    packPatterns(distances, CORNER_PATTERN_COUNT, cornerPatterns);
+}
+
+// fill an edge pattern database with a breadth first search from the solved edges
+void initEdgePatterns(vector <unsigned char>& edgePatterns, int firstEdge)
+{
+    vector <unsigned char> distances(EDGE_PATTERN_COUNT / 2, 255);
+    unsigned char solved[6];
+    for (int i = 0; i < 6; i++)
+    {
+        solved[i] = 2 * (firstEdge + i);
+    }
+    setNibble(distances.data(), getEdgePatternIndex(solved), 0);
+    int filled = 1;
+    for (int depth = 0; filled < EDGE_PATTERN_COUNT; depth++)
+    {
+        for (int i = 0; i < EDGE_PATTERN_COUNT; i++)
         {
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
+            if (getNibble(distances.data(), i) == depth)
+            {
+                unsigned char positions[6];
+                setEdgePatternIndex(positions, i);
+                for (int move = 0; move < 18; move++)
+                {
+                    unsigned char moved[6];
+                    for (int j = 0; j < 6; j++)
+                    {
+                        moved[j] = edgePositionMoves[move][positions[j]];
+                    }
+                    int next = getEdgePatternIndex(moved);
+                    if (getNibble(distances.data(), next) == 15)
+                    {
+                        setNibble(distances.data(), next, depth + 1);
+                        filled++;
+                    }
+                }
+            }
         }
-        else if (moves[i] == 5)
+    }
+    packPatterns(distances, EDGE_PATTERN_COUNT, edgePatterns);
+}
+
+// get number of moves to solve the corners by following pattern database entries down to the solved corners
+int getCornerDistance(int cornerPerm, int twist)
+{
+    int distance = 0;
+    while (cornerPerm != 0 || twist != 0)
+    {
+        int lower = (getPattern(cornerPatterns.data(), cornerPerm * TWIST_COUNT + twist) + 2) % 3;
+        for (int move = 0; move < 18; move++)
         {
-            turnDFace(2, pieces, edgeStickers, cornerStickers, rotation);
+            int nextCornerPerm = fullCornerPermMoves[cornerPerm * 18 + move];
+            int nextTwist = twistMoves[twist * 18 + move];
+            if (getPattern(cornerPatterns.data(), nextCornerPerm * TWIST_COUNT + nextTwist) == lower)
+            {
+                cornerPerm = nextCornerPerm;
+                twist = nextTwist;
+                break;
+            }
         }
-        else if (moves[i] == 6)
+        distance++;
+    }
+    return distance;
+}
+
+// get number of moves to solve six edges by following pattern database entries down to the solved edges
+int getEdgeDistance(const vector <unsigned char>& edgePatterns, const unsigned char* edges, int firstEdge)
+{
+    unsigned char positions[6];
+    unsigned char solved[6];
+    for (int i = 0; i < 6; i++)
+    {
+        positions[i] = edges[i];
+        solved[i] = 2 * (firstEdge + i);
+    }
+    int distance = 0;
+    while (memcmp(positions, solved, 6) != 0)
+    {
+        int lower = (getPattern(edgePatterns.data(), getEdgePatternIndex(positions)) + 2) % 3;
+        for (int move = 0; move < 18; move++)
         {
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
+            unsigned char moved[6];
+            for (int j = 0; j < 6; j++)
+            {
+                moved[j] = edgePositionMoves[move][positions[j]];
+            }
+            if (getPattern(edgePatterns.data(), getEdgePatternIndex(moved)) == lower)
+            {
+                memcpy(positions, moved, 6);
+                break;
+            }
         }
-        else if (moves[i] == 7)
+        distance++;
+    }
+    return distance;
+}
+
+// load pattern databases from file
+bool loadPatterns(string path)
+{
+    ifstream file(path.c_str(), ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    cornerPatterns.resize(CORNER_PATTERN_COUNT / 4);
+    firstEdgePatterns.resize(EDGE_PATTERN_COUNT / 4);
+    lastEdgePatterns.resize(EDGE_PATTERN_COUNT / 4);
+    file.read((char*)cornerPatterns.data(), cornerPatterns.size());
+    file.read((char*)firstEdgePatterns.data(), firstEdgePatterns.size());
+    file.read((char*)lastEdgePatterns.data(), lastEdgePatterns.size());
+
+    // the file must hold exactly the three pattern databases
+    if (!file || file.peek() != EOF)
+    {
+        cout << "ERROR::PATTERNS::FILE_NOT_VALID" << endl;
+        return false;
+    }
+    return true;
+}
+
+// save pattern databases to file
+void savePatterns(string path)
+{
+    ofstream file(path.c_str(), ios::binary);
+    file.write((const char*)cornerPatterns.data(), cornerPatterns.size());
+    file.write((const char*)firstEdgePatterns.data(), firstEdgePatterns.size());
+    file.write((const char*)lastEdgePatterns.data(), lastEdgePatterns.size());
+    if (!file)
+    {
+        cout << "ERROR::PATTERNS::FILE_NOT_WRITTEN" << endl;
+    }
+}
+
+// generate move tables and pattern databases of the optimal solver the first time they are needed
+void initOptimalTables()
+{
+    static bool initialized = false;
+    if (initialized)
+    {
+        return;
+    }
+    initialized = true;
+    initTwoPhaseTables();
+
+    // move tables
+    initCoordinateMoves(fullCornerPermMoves, CORNER_PERM_COUNT, faceMoves, 18, setCornerPerm, getCornerPerm);
+    for (int move = 0; move < 18; move++)
+    {
+        for (int slot = 0; slot < 12; slot++)
         {
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
+            int source = packedMoves[move].edgeShuffle[slot];
+            int flip = packedMoves[move].edgeFlip[slot] >> 4;
+            edgePositionMoves[move][2 * source] = 2 * slot + flip;
+            edgePositionMoves[move][2 * source + 1] = 2 * slot + (flip ^ 1);
         }
-        else if (moves[i] == 8)
+    }
+    for (int i = 1; i < 4096; i++)
+    {
+        slotCounts[i] = slotCounts[i >> 1] + (i & 1);
+    }
+
+    // pattern databases take a minute or two to generate, so they are saved to a file and loaded next time
+    if (loadPatterns("patterns.bin") == false)
+    {
+        cout << "Generating pattern databases, this may take a few minutes" << endl;
+        initCornerPatterns();
+        initEdgePatterns(firstEdgePatterns, 0);
+        initEdgePatterns(lastEdgePatterns, 6);
+        savePatterns("patterns.bin");
+    }
+}
+
+// optimal search class
+class OptimalSearch
+{
+private:
+    // declare variables
+    Move moves[32];
+    const unsigned char* corners;
+    const unsigned char* firstEdges;
+    const unsigned char* lastEdges;
+
+    // search to the given depth, using the position of every edge as 2 * slot + flip
+    bool search(int cornerPerm, int twist, const unsigned char* edges, int depth, int togo, int lastFace, int cornerDistance, int firstDistance, int lastDistance)
+    {
+        nodes++;
+        if (togo == 0)
         {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
+            // every pattern database is at zero only when the cube is solved
+            return true;
         }
-        else if (moves[i] == 9)
-        {
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
+
+        // find corners of every child and start loading their pattern database entries, so the cache misses overlap
+        Move childMoves[18];
+        int childCornerPerms[18];
+        int childTwists[18];
+        int childCount = 0;
+        for (int move = 0; move < 18; move++)
+        {
+            if (canFollow(lastFace, move / 3))
+            {
+                childMoves[childCount] = move;
+                childCornerPerms[childCount] = fullCornerPermMoves[cornerPerm * 18 + move];
+                childTwists[childCount] = twistMoves[twist * 18 + move];
+                prefetchPattern(corners, childCornerPerms[childCount] * TWIST_COUNT + childTwists[childCount]);
+                childCount++;
+            }
         }
-        else if (moves[i] == 10)
-        {
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
+
+        // keep children whose corners are close enough to solved, then find their edges and load those entries
+        unsigned char childEdges[18][12];
+        int childCornerDistances[18];
+        int firstIndices[18];
+        int lastIndices[18];
+        int keptCount = 0;
+        for (int i = 0; i < childCount; i++)
+        {
+            childCornerDistances[keptCount] = getChildDistance(cornerDistance, getPattern(corners, childCornerPerms[i] * TWIST_COUNT + childTwists[i]));
+            if (childCornerDistances[keptCount] >= togo)
+            {
+                continue;
+            }
+            for (int j = 0; j < 12; j++)
+            {
+                childEdges[keptCount][j] = edgePositionMoves[childMoves[i]][edges[j]];
+            }
+            firstIndices[keptCount] = getEdgePatternIndex(childEdges[keptCount]);
+            lastIndices[keptCount] = getEdgePatternIndex(childEdges[keptCount] + 6);
+            prefetchPattern(firstEdges, firstIndices[keptCount]);
+            prefetchPattern(lastEdges, lastIndices[keptCount]);
+            childMoves[keptCount] = childMoves[i];
+            childCornerPerms[keptCount] = childCornerPerms[i];
+            childTwists[keptCount] = childTwists[i];
+            keptCount++;
         }
-        else if (moves[i] == 11)
+
+        // search children whose edges are also close enough to solved
+        for (int i = 0; i < keptCount; i++)
         {
-            turnRFace(2, pieces, edgeStickers, cornerStickers, rotation);
+            int childFirstDistance = getChildDistance(firstDistance, getPattern(firstEdges, firstIndices[i]));
+            int childLastDistance = getChildDistance(lastDistance, getPattern(lastEdges, lastIndices[i]));
+            if (childFirstDistance >= togo || childLastDistance >= togo)
+            {
+                continue;
+            }
+            moves[depth] = childMoves[i];
+            if (search(childCornerPerms[i], childTwists[i], childEdges[i], depth + 1, togo - 1, childMoves[i] / 3, childCornerDistances[i], childFirstDistance, childLastDistance))
+            {
+                return true;
+            }
         }
-        else if (moves[i] == 12)
+        return false;
+    }
+public:
+    // declare node counter
+    long long nodes;
+
+    // find a shortest solution
+    vector <Move> solve(const PackedCube& cube)
+    {
+        initOptimalTables();
+        corners = cornerPatterns.data();
+        firstEdges = firstEdgePatterns.data();
+        lastEdges = lastEdgePatterns.data();
+        nodes = 0;
+
+        // find position of every edge
+        unsigned char edges[12];
+        for (int slot = 0; slot < 12; slot++)
         {
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
+            edges[cube.edges[slot] & 15] = 2 * slot + (cube.edges[slot] >> 4);
         }
-        else if (moves[i] == 13)
-        {
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
+        int cornerPerm = getCornerPerm(cube);
+        int twist = getTwist(cube);
+
+        // search with increasing depth
+        int cornerDistance = getCornerDistance(cornerPerm, twist);
+        int firstDistance = getEdgeDistance(firstEdgePatterns, edges, 0);
+        int lastDistance = getEdgeDistance(lastEdgePatterns, edges + 6, 6);
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        for (int depth = max(cornerDistance, max(firstDistance, lastDistance)); depth <= 20; depth++)
+        {
+            bool found = search(cornerPerm, twist, edges, 0, depth, -1, cornerDistance, firstDistance, lastDistance);
+            double time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            cout << "Searched to depth " << depth << ": " << nodes << " nodes in " << time << " seconds (" << nodes / max(time, 1e-9) << " nodes/s)" << endl;
+            if (found)
+            {
+                return vector <Move>(moves, moves + depth);
+            }
         }
-        else if (moves[i] == 14)
+        return vector <Move>();
+    }
+};
+
+// thistlethwaite solver
+// solves the cube in four phases, each moving it into a smaller group: edges oriented, then corners oriented with the
+// E slice edges in the E slice, then every piece where half turns can reach it, then solved
+// each phase has a table of how many moves it needs, indexed by a small coordinate, and simply follows the table down,
+// so every phase is as short as possible while all tables together stay under a few megabytes
+
+// declare sizes of coordinates
+const int CORNER_COSET_COUNT = 420; // sets of corner permutations that differ by half turns
+const int HALF_TURN_CORNER_COUNT = 96; // corner permutations reachable with half turns
+const int M_SLICE_COUNT = 70; // positions of M slice edges among the U and D edge slots
+const int HALF_TURN_EDGE_COUNT = 576; // permutations of S slice edges times permutations of E slice edges
+
+// declare moves allowed in each phase
+const int G1_MOVE_COUNT = 14;
+const Move g1Moves[G1_MOVE_COUNT] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 16 };
+const int HALF_TURN_COUNT = 6;
+const Move halfTurns[HALF_TURN_COUNT] = { 1, 4, 7, 10, 13, 16 };
+const Move* const thistlethwaiteMoves[4] = { faceMoves, g1Moves, phase2Moves, halfTurns };
+const int thistlethwaiteMoveCounts[4] = { 18, G1_MOVE_COUNT, PHASE_2_MOVE_COUNT, HALF_TURN_COUNT };
+
+// declare corner permutation sets
+unsigned short cornerCosets[CORNER_PERM_COUNT];
+unsigned short cosetCornerPerms[CORNER_COSET_COUNT]; // one permutation of each set
+unsigned char halfTurnCornerIndex[CORNER_PERM_COUNT];
+unsigned short halfTurnCornerPerms[HALF_TURN_CORNER_COUNT];
+
+// declare move tables
+const unsigned short unchangedMoves[18] = { 0 };
+unsigned short g1TwistMoves[TWIST_COUNT * G1_MOVE_COUNT];
+unsigned short g1SliceMoves[SLICE_COUNT * G1_MOVE_COUNT];
+unsigned short cornerCosetMoves[CORNER_COSET_COUNT * PHASE_2_MOVE_COUNT];
+unsigned short mSliceMoves[M_SLICE_COUNT * PHASE_2_MOVE_COUNT];
+unsigned short halfTurnCornerMoves[HALF_TURN_CORNER_COUNT * 24 * HALF_TURN_COUNT];
+unsigned short halfTurnEdgeMoves[HALF_TURN_EDGE_COUNT * HALF_TURN_COUNT];
+
+// declare tables of moves needed by each phase
+unsigned char flipDistances[FLIP_COUNT];
+unsigned char twistSliceDistances[TWIST_COUNT * SLICE_COUNT];
+unsigned char cosetSliceDistances[CORNER_COSET_COUNT * M_SLICE_COUNT];
+unsigned char halfTurnDistances[HALF_TURN_CORNER_COUNT * 24 * HALF_TURN_EDGE_COUNT];
+
+// get set of corner permutation
+int getCornerCoset(const PackedCube& cube)
+{
+    return cornerCosets[getCornerPerm(cube)];
+}
+
+// set corner permutation to one of a set
+void setCornerCoset(PackedCube& cube, int coset)
+{
+    setCornerPerm(cube, cosetCornerPerms[coset]);
+}
+
+// get slots of M slice edges among the U and D edge slots, ignoring their order
+int getMSlice(const PackedCube& cube)
+{
+    int mSlice = 0;
+    int found = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        if (getTwoPhaseEdge(cube, i) < 4)
+        {
+            found++;
+            mSlice += binomial(i, found);
+        }
+    }
+    return mSlice;
+}
+
+// set slots of M slice edges among the U and D edge slots
+void setMSlice(PackedCube& cube, int mSlice)
+{
+    // find slots of M slice edges
+    bool isMSliceSlot[8] = { false };
+    for (int k = 4; k >= 1; k--)
+    {
+        int slot = k - 1;
+        while (binomial(slot + 1, k) <= mSlice)
+        {
+            slot++;
+        }
+        isMSliceSlot[slot] = true;
+        mSlice -= binomial(slot, k);
+    }
+    // fill slots
+    int mSlicePiece = 0;
+    int sSlicePiece = 4;
+    for (int i = 0; i < 8; i++)
+    {
+        setTwoPhaseEdge(cube, i, isMSliceSlot[i] ? mSlicePiece++ : sSlicePiece++);
+    }
+}
+
+// get permutation of four edges in four slots, starting from the given slot in the order used by the two-phase solver
+int getSlicePermFrom(const PackedCube& cube, int first)
+{
+    int permutation[4];
+    for (int i = 0; i < 4; i++)
+    {
+        permutation[i] = getTwoPhaseEdge(cube, first + i) - first;
+    }
+    return rankPermutation(permutation, 4);
+}
+
+// set permutation of four edges in four slots
+void setSlicePermFrom(PackedCube& cube, int first, int slicePerm)
+{
+    int permutation[4];
+    unrankPermutation(slicePerm, permutation, 4);
+    for (int i = 0; i < 4; i++)
+    {
+        setTwoPhaseEdge(cube, first + i, first + permutation[i]);
+    }
+}
+
+// get permutation of corners and M slice edges, only meaningful in phase 4
+int getHalfTurnCorners(const PackedCube& cube)
+{
+    return halfTurnCornerIndex[getCornerPerm(cube)] * 24 + getSlicePermFrom(cube, 0);
+}
+
+// set permutation of corners and M slice edges
+void setHalfTurnCorners(PackedCube& cube, int halfTurnCorners)
+{
+    setCornerPerm(cube, halfTurnCornerPerms[halfTurnCorners / 24]);
+    setSlicePermFrom(cube, 0, halfTurnCorners % 24);
+}
+
+// get permutation of S and E slice edges, only meaningful in phase 4
+int getHalfTurnEdges(const PackedCube& cube)
+{
+    return getSlicePermFrom(cube, 4) * 24 + getSlicePermFrom(cube, 8);
+}
+
+// set permutation of S and E slice edges
+void setHalfTurnEdges(PackedCube& cube, int halfTurnEdges)
+{
+    setSlicePermFrom(cube, 4, halfTurnEdges / 24);
+    setSlicePermFrom(cube, 8, halfTurnEdges % 24);
+}
+
+// group corner permutations into sets whose permutations differ by half turns made before them
+// the set holding the solved permutation is numbered 0 and holds every permutation reachable with half turns
+void initCornerCosets()
+{
+    memset(cornerCosets, 255, sizeof(cornerCosets));
+    int cosetCount = 0;
+    int halfTurnCornerCount = 0;
+    vector <int> found;
+    for (int start = 0; start < CORNER_PERM_COUNT; start++)
+    {
+        if (cornerCosets[start] != 0xFFFF)
+        {
+            continue;
+        }
+        // find every permutation of the set by relabelling the corners of each one found with each half turn
+        cornerCosets[start] = cosetCount;
+        cosetCornerPerms[cosetCount] = start;
+        found.assign(1, start);
+        for (int i = 0; i < (int)found.size(); i++)
+        {
+            int permutation[8];
+            unrankPermutation(found[i], permutation, 8);
+            if (cosetCount == 0)
+            {
+                halfTurnCornerIndex[found[i]] = halfTurnCornerCount;
+                halfTurnCornerPerms[halfTurnCornerCount++] = found[i];
+            }
+            for (int j = 0; j < HALF_TURN_COUNT; j++)
+            {
+                int relabelled[8];
+                for (int k = 0; k < 8; k++)
+                {
+                    relabelled[k] = packedMoves[halfTurns[j]].cornerShuffle[permutation[k]];
+                }
+                int next = rankPermutation(relabelled, 8);
+                if (cornerCosets[next] == 0xFFFF)
+                {
+                    cornerCosets[next] = cosetCount;
+                    found.push_back(next);
+                }
+            }
+        }
+        cosetCount++;
+    }
+    if (cosetCount != CORNER_COSET_COUNT || halfTurnCornerCount != HALF_TURN_CORNER_COUNT)
+    {
+        cout << "ERROR::THISTLETHWAITE::CORNER_SETS_NOT_VALID" << endl;
+    }
+}
+
+// generate tables of the thistlethwaite solver the first time they are needed
+void initThistlethwaiteTables()
+{
+    static bool initialized = false;
+    if (initialized)
+    {
+        return;
+    }
+    initialized = true;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    // move tables
+    initCornerCosets();
+    initCoordinateMoves(flipMoves, FLIP_COUNT, faceMoves, 18, setFlip, getFlip);
+    initCoordinateMoves(g1TwistMoves, TWIST_COUNT, g1Moves, G1_MOVE_COUNT, setTwist, getTwist);
+    initCoordinateMoves(g1SliceMoves, SLICE_COUNT, g1Moves, G1_MOVE_COUNT, setSlice, getSlice);
+    initCoordinateMoves(cornerCosetMoves, CORNER_COSET_COUNT, phase2Moves, PHASE_2_MOVE_COUNT, setCornerCoset, getCornerCoset);
+    initCoordinateMoves(mSliceMoves, M_SLICE_COUNT, phase2Moves, PHASE_2_MOVE_COUNT, setMSlice, getMSlice);
+    initCoordinateMoves(halfTurnCornerMoves, HALF_TURN_CORNER_COUNT * 24, halfTurns, HALF_TURN_COUNT, setHalfTurnCorners, getHalfTurnCorners);
+    initCoordinateMoves(halfTurnEdgeMoves, HALF_TURN_EDGE_COUNT, halfTurns, HALF_TURN_COUNT, setHalfTurnEdges, getHalfTurnEdges);
+
+    // tables of moves needed by each phase, where phase 1 pairs the edge orientation with a coordinate that never changes
+    initPruneTable(flipDistances, FLIP_COUNT, flipMoves, 1, unchangedMoves, 18, 0, 0);
+    initPruneTable(twistSliceDistances, TWIST_COUNT, g1TwistMoves, SLICE_COUNT, g1SliceMoves, G1_MOVE_COUNT, 0, SOLVED_SLICE);
+    initPruneTable(cosetSliceDistances, CORNER_COSET_COUNT, cornerCosetMoves, M_SLICE_COUNT, mSliceMoves, PHASE_2_MOVE_COUNT, 0, 0);
+    initPruneTable(halfTurnDistances, HALF_TURN_CORNER_COUNT * 24, halfTurnCornerMoves, HALF_TURN_EDGE_COUNT, halfTurnEdgeMoves, HALF_TURN_COUNT, 0, 0);
+
+    // report memory of every table, all of which are kept until the program ends
+    size_t tableMemory = sizeof(cornerCosets) + sizeof(cosetCornerPerms) + sizeof(halfTurnCornerIndex) + sizeof(halfTurnCornerPerms)
+        + sizeof(flipMoves) + sizeof(g1TwistMoves) + sizeof(g1SliceMoves) + sizeof(cornerCosetMoves) + sizeof(mSliceMoves)
+        + sizeof(halfTurnCornerMoves) + sizeof(halfTurnEdgeMoves)
+        + sizeof(flipDistances) + sizeof(twistSliceDistances) + sizeof(cosetSliceDistances) + sizeof(halfTurnDistances);
+    cout << "Generated thistlethwaite tables in " << chrono::duration<double>(chrono::steady_clock::now() - start).count() << " seconds, using " << tableMemory / 1024 << " KB" << endl;
+}
+
+// get number of moves needed to finish a phase of the thistlethwaite solver
+int getThistlethwaiteDistance(int phase, const PackedCube& cube)
+{
+    if (phase == 0)
+    {
+        return flipDistances[getFlip(cube)];
+    }
+    else if (phase == 1)
+    {
+        return twistSliceDistances[getTwist(cube) * SLICE_COUNT + getSlice(cube)];
+    }
+    else if (phase == 2)
+    {
+        return cosetSliceDistances[getCornerCoset(cube) * M_SLICE_COUNT + getMSlice(cube)];
+    }
+    return halfTurnDistances[getHalfTurnCorners(cube) * HALF_TURN_EDGE_COUNT + getHalfTurnEdges(cube)];
+}
+
+// add move to end of a solution, joining it with turns of the same face that it directly follows
+void addMove(vector <Move>& moves, Move move)
+{
+    int face = move / 3;
+    int degree = move % 3 + 1;
+    int last = (int)moves.size() - 1;
+    // skip over a turn of the opposite face, which can be swapped with this turn
+    if (last >= 1 && moves[last] / 3 != face && moves[last] / 6 == move / 6 && moves[last - 1] / 3 == face)
+    {
+        last--;
+    }
+    if (last >= 0 && moves[last] / 3 == face)
+    {
+        degree = (degree + moves[last] % 3 + 1) % 4;
+        moves.erase(moves.begin() + last);
+        if (degree == 0)
+        {
+            return;
+        }
+        moves.insert(moves.begin() + last, makeMove(face, degree));
+        return;
+    }
+    moves.push_back(move);
+}
+
+// solve cube with the thistlethwaite solver
+vector <Move> solveThistlethwaite(PackedCube cube)
+{
+    initThistlethwaiteTables();
+    vector <Move> solution;
+    for (int phase = 0; phase < 4; phase++)
+    {
+        // make any move that brings the cube closer to the end of the phase
+        int distance = getThistlethwaiteDistance(phase, cube);
+        while (distance > 0)
+        {
+            for (int i = 0; i < thistlethwaiteMoveCounts[phase]; i++)
+            {
+                PackedCube next = cube;
+                applyPackedMove(next, thistlethwaiteMoves[phase][i]);
+                if (getThistlethwaiteDistance(phase, next) < distance)
+                {
+                    cube = next;
+                    distance--;
+                    addMove(solution, thistlethwaiteMoves[phase][i]);
+                    break;
+                }
+            }
+        }
+    }
+    return solution;
+}
+
+// random-state scrambler
+// picks a state uniformly from every state the cube can reach, and scrambles with the inverse of a thistlethwaite
+// solution of it, which is longer than a two-phase solution but is found without searching
+// the solver only reads its tables, so scrambles can be made on several threads, each with its own random generator,
+// once the tables have been generated
+
+// declare longest scramble, the four thistlethwaite phases need at most 7, 10, 13, and 15 moves
+const int MAX_SCRAMBLE_LENGTH = 45;
+
+// shuffle pieces into random slots, returns whether the pieces were left in an odd permutation
+bool shufflePieces(RandomGenerator& generator, unsigned char* pieces, int count)
+{
+    bool odd = false;
+    for (int i = count - 1; i > 0; i--)
+    {
+        int j = generator.below(i + 1);
+        if (j != i)
+        {
+            swap(pieces[i], pieces[j]);
+            odd = !odd;
+        }
+    }
+    return odd;
+}
+
+// generate packed cube in a uniformly random state
+PackedCube randomPackedCube(RandomGenerator& generator)
+{
+    PackedCube cube = solvedPackedCube;
+    bool oddCorners = shufflePieces(generator, cube.corners, 8);
+    bool oddEdges = shufflePieces(generator, cube.edges, 12);
+    // face turns always swap corners and edges together, so a state where only one is odd is fixed by swapping two edges
+    // this pairs every unreachable state with one reachable state, so reachable states stay equally likely
+    if (oddCorners != oddEdges)
+    {
+        swap(cube.edges[10], cube.edges[11]);
+    }
+    // the last corner and edge orientations are fixed by the others
+    setTwist(cube, generator.below(TWIST_COUNT));
+    setFlip(cube, generator.below(FLIP_COUNT));
+    return cube;
+}
+
+// generate scramble that takes a solved cube to a state, returns its length
+int generateScrambleTo(const PackedCube& state, Move* moves)
+{
+    vector <Move> solution = solveThistlethwaite(state);
+    int length = solution.size();
+    for (int i = 0; i < length; i++)
+    {
+        moves[i] = inverseMove(solution[length - 1 - i]);
+    }
+    return length;
+}
+
+// generate scramble that takes a solved cube to a uniformly random state, returns its length
+int generateRandomStateScramble(RandomGenerator& generator, Move* moves)
+{
+    return generateScrambleTo(randomPackedCube(generator), moves);
+}
+
+// benchmark scrambles per second of the random-state scrambler
+void benchmarkScramble()
+{
+    const int STATE_COUNT = 1000000;
+    const int SCRAMBLE_COUNT = 100000;
+
+    // generate tables first so they aren't timed
+    initThistlethwaiteTables();
+
+    // time picking states on their own, and with their scrambles
+    vector <PackedCube> states(STATE_COUNT);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int i = 0; i < STATE_COUNT; i++)
+    {
+        states[i] = randomPackedCube(randomGenerator);
+    }
+    double stateSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    int totalLength = 0;
+    int longest = 0;
+    int failed = 0;
+    Move moves[MAX_SCRAMBLE_LENGTH];
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < SCRAMBLE_COUNT; i++)
+    {
+        int length = generateScrambleTo(states[i], moves);
+        totalLength += length;
+        longest = max(longest, length);
+
+        // check that every few scrambles reach their state, by undoing them with the batch kernel
+        if (i % 100 == 0)
+        {
+            vector <Move> undo;
+            for (int j = length - 1; j >= 0; j--)
+            {
+                undo.push_back(inverseMove(moves[j]));
+            }
+            failed += countSolvedBatch(vector <PackedCube>(1, states[i]), undo) != 1;
+        }
+    }
+    double scrambleSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // display results
+    cout << "random states: " << STATE_COUNT / stateSeconds / 1e6 << " million per second" << endl;
+    cout << "scrambles:     " << SCRAMBLE_COUNT / scrambleSeconds << " per second, average length " << (double)totalLength / SCRAMBLE_COUNT << " moves, longest " << longest << " moves" << endl;
+    if (failed > 0)
+    {
+        cout << "ERROR::SCRAMBLER::" << failed << "_SCRAMBLES_FAILED" << endl;
+    }
+}
+
+// declare solvers
+enum Solver
+{
+    OLD_POCHMANN,
+    TWO_PHASE,
+    OPTIMAL,
+    THISTLETHWAITE
+};
+Solver solver = OLD_POCHMANN;
+int twoPhaseTargetLength = 21;
+double twoPhaseTimeLimit = 1.0;
+
+// find solution with the selected search solver, without rendering
+vector <Move> findSolution(const CubeState& cube)
+{
+    if (solver == OPTIMAL)
+    {
+        static OptimalSearch search;
+        return search.solve(packCube(cube));
+    }
+    if (solver == THISTLETHWAITE)
+    {
+        return solveThistlethwaite(packCube(cube));
+    }
+    static TwoPhaseSearch search;
+    return search.solve(packCube(cube), twoPhaseTargetLength, twoPhaseTimeLimit);
+}
+
+
+// make a move on a cube and add it to a plan
+void planMove(CubeState& cube, vector <Move>& plan, int layer, int degree)
+{
+    Move move = makeMove(layer, degree);
+    applyMove(cube, move);
+    plan.push_back(move);
+}
+
+// perform edge swap algorithm
+void edgeSwap(CubeState& cube, vector <Move>& plan)
+{
+    // perform algorithm
+    planMove(cube, plan, R_FACE, 1);
+    planMove(cube, plan, U_FACE, 1);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, U_FACE, 3);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, F_FACE, 1);
+    planMove(cube, plan, R_FACE, 2);
+    planMove(cube, plan, U_FACE, 3);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, U_FACE, 3);
+    planMove(cube, plan, R_FACE, 1);
+    planMove(cube, plan, U_FACE, 1);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, F_FACE, 3);
+}
+
+// perform corner swap algorithm
+void cornerSwap(CubeState& cube, vector <Move>& plan)
+{
+    // perform algorithm
+    planMove(cube, plan, R_FACE, 1);
+    planMove(cube, plan, U_FACE, 3);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, U_FACE, 3);
+    planMove(cube, plan, R_FACE, 1);
+    planMove(cube, plan, U_FACE, 1);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, F_FACE, 3);
+    planMove(cube, plan, R_FACE, 1);
+    planMove(cube, plan, U_FACE, 1);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, U_FACE, 3);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, F_FACE, 1);
+    planMove(cube, plan, R_FACE, 1);
+}
+
+// perform parity algorithm
+void parity(CubeState& cube, vector <Move>& plan)
+{
+    planMove(cube, plan, R_FACE, 1);
+    planMove(cube, plan, U_FACE, 3);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, U_FACE, 3);
+    planMove(cube, plan, R_FACE, 1);
+    planMove(cube, plan, U_FACE, 1);
+    planMove(cube, plan, R_FACE, 1);
+    planMove(cube, plan, D_FACE, 1);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, U_FACE, 3);
+    planMove(cube, plan, R_FACE, 1);
+    planMove(cube, plan, D_FACE, 3);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, U_FACE, 2);
+    planMove(cube, plan, R_FACE, 3);
+    planMove(cube, plan, U_FACE, 3);
+}
+
+// orient cube
+void orientCube(int frontFace, int topFace, CubeState& cube, vector <Move>& plan)
+{
+    // orient front face
+    for (int i = 0; i < 3; i++)
+    {
+        // check if front face is already oriented
+        if (cube.pieces[2] == frontFace)
+        {
+            break;
+        }
+        // rotate cube
+        else
+        {
+            planMove(cube, plan, Y_AXIS, 1);
+        }
+    }
+    // orient front face if it is on the top or bottom
+    if (cube.pieces[2] != frontFace)
+    {
+        planMove(cube, plan, X_AXIS, 1);
+    }
+    // a half turn is needed if the first rotation moved the front face to the back
+    if (cube.pieces[2] != frontFace)
+    {
+        planMove(cube, plan, X_AXIS, 2);
+    }
+
+    // orient top face
+    for (int i = 0; i < 3; i++)
+    {
+        // check if top face is already oriented
+        if (cube.pieces[0] == topFace)
+        {
+            break;
+        }
+        // rotate cube
+        else
+        {
+            planMove(cube, plan, Z_AXIS, 1);
+        }
+    }
+}
+
+// solve edges
+void solveEdges(CubeState& cube, vector <Move>& plan)
+{
+    // solve one piece at a time until all edges are solved
+    while (isSolved("EDGES", cube) == false)
+    {
+        int target;
+        // find target piece if edge buffer piece is in buffer position
+        if (cube.pieces[15] == 15)
+        {
+            // choose an unsolved piece as target
+            for (int i = 0; i < 24; i++)
+            {
+                if (cube.edgeStickers[i] != i && i != 1 && i != 12)
+                {
+                    target = i;
+                    break;
+                }
+            }
+        }
+        // find target piece if edge buffer piece is not in buffer position
+        else
+        {
+            // find target piece
+            target = cube.edgeStickers[1];
+        }
+        // move target piece into setup position
+        if (target == 0)
+        {
+            planMove(cube, plan, M_SLICE, 2);
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 2)
+        {
+            planMove(cube, plan, M_SLICE, 2);
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 4)
+        {
+            planMove(cube, plan, L_FACE, 1);
+            planMove(cube, plan, E_SLICE, 3);
+            planMove(cube, plan, L_FACE, 1);
+        }
+        else if (target == 5)
+        {
+            planMove(cube, plan, E_SLICE, 3);
+            planMove(cube, plan, L_FACE, 1);
+        }
+        else if (target == 6)
+        {
+            planMove(cube, plan, L_FACE, 3);
+            planMove(cube, plan, E_SLICE, 3);
+            planMove(cube, plan, L_FACE, 1);
+        }
+        else if (target == 7)
+        {
+            planMove(cube, plan, E_SLICE, 1);
+            planMove(cube, plan, L_FACE, 3);
+        }
+        else if (target == 8)
+        {
+            planMove(cube, plan, M_SLICE, 1);
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 9)
+        {
+            planMove(cube, plan, E_SLICE, 2);
+            planMove(cube, plan, L_FACE, 1);
+        }
+        else if (target == 10)
+        {
+            planMove(cube, plan, M_SLICE, 1);
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 11)
+        {
+            planMove(cube, plan, L_FACE, 3);
+        }
+        else if (target == 13)
+        {
+            planMove(cube, plan, E_SLICE, 1);
+            planMove(cube, plan, L_FACE, 1);
+        }
+        else if (target == 14)
+        {
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, M_SLICE, 1);
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 15)
+        {
+            planMove(cube, plan, E_SLICE, 3);
+            planMove(cube, plan, L_FACE, 3);
+        }
+        else if (target == 16)
+        {
+            planMove(cube, plan, M_SLICE, 3);
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 17)
+        {
+            planMove(cube, plan, L_FACE, 1);
+        }
+        else if (target == 18)
+        {
+            planMove(cube, plan, M_SLICE, 3);
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 19)
+        {
+            planMove(cube, plan, E_SLICE, 2);
+            planMove(cube, plan, L_FACE, 3);
+        }
+        else if (target == 20)
+        {
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 21)
+        {
+            planMove(cube, plan, D_FACE, 2);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 22)
+        {
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, L_FACE, 2);
+        }
+        else if (target == 23)
+        {
+            planMove(cube, plan, L_FACE, 2);
+        }
+        // perform edge swap algorithm
+        edgeSwap(cube, plan);
+        // undo moves that were performed to move piece into setup position
+        if (target == 0)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, M_SLICE, 2);
+        }
+        else if (target == 2)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, M_SLICE, 2);
+        }
+        else if (target == 4)
+        {
+            planMove(cube, plan, L_FACE, 3);
+            planMove(cube, plan, E_SLICE, 1);
+            planMove(cube, plan, L_FACE, 3);
+        }
+        else if (target == 5)
+        {
+            planMove(cube, plan, L_FACE, 3);
+            planMove(cube, plan, E_SLICE, 1);
+        }
+        else if (target == 6)
+        {
+            planMove(cube, plan, L_FACE, 1);
+            planMove(cube, plan, E_SLICE, 1);
+            planMove(cube, plan, L_FACE, 3);
+        }
+        else if (target == 7)
+        {
+            planMove(cube, plan, L_FACE, 1);
+            planMove(cube, plan, E_SLICE, 3);
+        }
+        else if (target == 8)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, M_SLICE, 3);
+        }
+        else if (target == 9)
+        {
+            planMove(cube, plan, L_FACE, 3);
+            planMove(cube, plan, E_SLICE, 2);
+        }
+        else if (target == 10)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, M_SLICE, 3);
+        }
+        else if (target == 11)
+        {
+            planMove(cube, plan, L_FACE, 1);
+        }
+        else if (target == 13)
+        {
+            planMove(cube, plan, L_FACE, 3);
+            planMove(cube, plan, E_SLICE, 3);
+        }
+        else if (target == 14)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, M_SLICE, 3);
+            planMove(cube, plan, D_FACE, 1);
+        }
+        else if (target == 15)
+        {
+            planMove(cube, plan, L_FACE, 1);
+            planMove(cube, plan, E_SLICE, 1);
+        }
+        else if (target == 16)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, M_SLICE, 1);
+        }
+        else if (target == 17)
+        {
+            planMove(cube, plan, L_FACE, 3);
+        }
+        else if (target == 18)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, M_SLICE, 1);
+        }
+        else if (target == 19)
+        {
+            planMove(cube, plan, L_FACE, 1);
+            planMove(cube, plan, E_SLICE, 2);
+        }
+        else if (target == 20)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 1);
+        }
+        else if (target == 21)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 2);
+        }
+        else if (target == 22)
+        {
+            planMove(cube, plan, L_FACE, 2);
+            planMove(cube, plan, D_FACE, 3);
+        }
+        else if (target == 23)
+        {
+            planMove(cube, plan, L_FACE, 2);
+        }
+    }
+}
+
+// solve corners
+void solveCorners(CubeState& cube, vector <Move>& plan)
+{
+    // solve one piece at a time until all corners are solved
+    while (isSolved("CORNERS", cube) == false)
+    {
+        int target;
+        // find target piece if corner buffer piece is in buffer position
+        if (cube.pieces[18] == 18)
+        {
+            // choose an unsolved piece as target
+            for (int i = 0; i < 24; i++)
+            {
+                if (cube.cornerStickers[i] != i && i != 0 && i != 4 && i != 17)
+                {
+                    target = i;
+                    break;
+                }
+            }
+        }
+        // find target piece if corner buffer piece is not in buffer position
+        else
+        {
+            // find target piece
+            target = cube.cornerStickers[4];
+        }
+        // move target piece into setup position
+        if (target == 1)
+        {
+            planMove(cube, plan, R_FACE, 2);
+        }
+        else if (target == 2)
+        {
+            planMove(cube, plan, F_FACE, 2);
+            planMove(cube, plan, D_FACE, 1);
+        }
+        else if (target == 3)
+        {
+            planMove(cube, plan, F_FACE, 2);
+        }
+        else if (target == 5)
+        {
+            planMove(cube, plan, F_FACE, 3);
+            planMove(cube, plan, D_FACE, 1);
+        }
+        else if (target == 6)
+        {
+            planMove(cube, plan, F_FACE, 3);
+        }
+        else if (target == 7)
+        {
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, R_FACE, 1);
+        }
+        else if (target == 8)
+        {
+            planMove(cube, plan, F_FACE, 1);
+            planMove(cube, plan, R_FACE, 3);
+        }
+        else if (target == 9)
+        {
+            planMove(cube, plan, R_FACE, 3);
+        }
+        else if (target == 10)
+        {
+            planMove(cube, plan, F_FACE, 3);
+            planMove(cube, plan, R_FACE, 3);
+        }
+        else if (target == 11)
+        {
+            planMove(cube, plan, F_FACE, 2);
+            planMove(cube, plan, R_FACE, 3);
+        }
+        else if (target == 12)
+        {
+            planMove(cube, plan, F_FACE, 1);
+        }
+        else if (target == 13)
+        {
+            planMove(cube, plan, R_FACE, 3);
+            planMove(cube, plan, F_FACE, 1);
+        }
+        else if (target == 14)
+        {
+            planMove(cube, plan, R_FACE, 2);
+            planMove(cube, plan, F_FACE, 1);
+        }
+        else if (target == 15)
+        {
+            planMove(cube, plan, R_FACE, 1);
+            planMove(cube, plan, F_FACE, 1);
+        }
+        else if (target == 16)
+        {
+            planMove(cube, plan, R_FACE, 1);
+            planMove(cube, plan, D_FACE, 3);
+        }
+        else if (target == 18)
+        {
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, F_FACE, 3);
+        }
+        else if (target == 19)
+        {
+            planMove(cube, plan, R_FACE, 1);
+        }
+        else if (target == 20)
+        {
+            planMove(cube, plan, D_FACE, 1);
+        }
+        else if (target == 22)
+        {
+            planMove(cube, plan, D_FACE, 3);
+        }
+        else if (target == 23)
+        {
+            planMove(cube, plan, D_FACE, 2);
+        }
+        // perform corner swap algorithm
+        cornerSwap(cube, plan);
+        // undo moves that were performed to move piece into setup position
+        if (target == 1)
+        {
+            planMove(cube, plan, R_FACE, 2);
+        }
+        else if (target == 2)
+        {
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, F_FACE, 2);
+        }
+        else if (target == 3)
+        {
+            planMove(cube, plan, F_FACE, 2);
+        }
+        else if (target == 5)
+        {
+            planMove(cube, plan, D_FACE, 3);
+            planMove(cube, plan, F_FACE, 1);
+        }
+        else if (target == 6)
+        {
+            planMove(cube, plan, F_FACE, 1);
+        }
+        else if (target == 7)
+        {
+            planMove(cube, plan, R_FACE, 3);
+            planMove(cube, plan, D_FACE, 1);
+        }
+        else if (target == 8)
+        {
+            planMove(cube, plan, R_FACE, 1);
+            planMove(cube, plan, F_FACE, 3);
+        }
+        else if (target == 9)
+        {
+            planMove(cube, plan, R_FACE, 1);
+        }
+        else if (target == 10)
+        {
+            planMove(cube, plan, R_FACE, 1);
+            planMove(cube, plan, F_FACE, 1);
+        }
+        else if (target == 11)
+        {
+            planMove(cube, plan, R_FACE, 1);
+            planMove(cube, plan, F_FACE, 2);
+        }
+        else if (target == 12)
+        {
+            planMove(cube, plan, F_FACE, 3);
+        }
+        else if (target == 13)
+        {
+            planMove(cube, plan, F_FACE, 3);
+            planMove(cube, plan, R_FACE, 1);
+        }
+        else if (target == 14)
+        {
+            planMove(cube, plan, F_FACE, 3);
+            planMove(cube, plan, R_FACE, 2);
+        }
+        else if (target == 15)
+        {
+            planMove(cube, plan, F_FACE, 3);
+            planMove(cube, plan, R_FACE, 3);
+        }
+        else if (target == 16)
+        {
+            planMove(cube, plan, D_FACE, 1);
+            planMove(cube, plan, R_FACE, 3);
+        }
+        else if (target == 18)
+        {
+            planMove(cube, plan, F_FACE, 1);
+            planMove(cube, plan, D_FACE, 3);
+        }
+        else if (target == 19)
+        {
+            planMove(cube, plan, R_FACE, 3);
+        }
+        else if (target == 20)
+        {
+            planMove(cube, plan, D_FACE, 3);
+        }
+        else if (target == 22)
+        {
+            planMove(cube, plan, D_FACE, 1);
+        }
+        else if (target == 23)
+        {
+            planMove(cube, plan, D_FACE, 2);
+        }
+    }
+}
+
+// plan solution of cube with the selected solver, on a copy of the cube that is not rendered
+vector <Move> planSolution(CubeState cube)
+{
+    vector <Move> plan;
+    cube.observer = NULL;
+    // check if cube is already solved
+    if (isSolved("CUBE", cube) == false)
+    {
+        // orient cube so that green face is at front and white face is on top
+        orientCube(2, 0, cube, plan);
+        // solve with a search solver if selected
+        if (solver != OLD_POCHMANN)
+        {
+            vector <Move> solution = findSolution(cube);
+            plan.insert(plan.end(), solution.begin(), solution.end());
+            return plan;
+        }
+        // solve edges
+        solveEdges(cube, plan);
+        // check if parity has occured
+        int unsolvedCorners = 0;
+        for (int i = 18; i < 26; i++)
+        {
+            if (cube.pieces[i] != i)
+            {
+                unsolvedCorners++;
+            }
+        }
+        // perform parity algorithm if needed
+        if (unsolvedCorners % 2 == 1)
+        {
+            parity(cube, plan);
+        }
+        // solve corners
+        solveCorners(cube, plan);
+    }
+    return plan;
+}
+
+// move scheduler class
+// plays queued moves on a cube at a steady rate, advanced by the main loop every frame instead of waiting between moves
+class MoveScheduler
+{
+private:
+    // declare variables
+    deque <Move> moves;
+    double timeUntilNext;
+public:
+    double movesPerSecond;
+
+    // constructor
+    MoveScheduler(double rate)
+    {
+        movesPerSecond = rate;
+        timeUntilNext = 0.0;
+    }
+
+    // add move to end of queue
+    void push(Move move)
+    {
+        moves.push_back(move);
+    }
+
+    // add every move of a plan to end of queue
+    void push(const vector <Move>& plan)
+    {
+        moves.insert(moves.end(), plan.begin(), plan.end());
+    }
+
+    // check if any queued move has not been made yet
+    bool hasQueuedMoves()
+    {
+        return !moves.empty();
+    }
+
+    // check if every queued move has been made and the last one has finished turning
+    bool isIdle()
+    {
+        return moves.empty() && timeUntilNext <= 0.0;
+    }
+
+    // find how much of the last move has been played, it turns over the time until the next move is due
+    double getTurnProgress()
+    {
+        return min(max(1.0 - timeUntilNext * movesPerSecond, 0.0), 1.0);
+    }
+
+    // advance by the time since the last frame, making every move that is due
+    void update(CubeState& cube, double deltaTime)
+    {
+        timeUntilNext -= deltaTime;
+        while (!moves.empty() && timeUntilNext <= 0.0)
+        {
+            applyMove(cube, moves.front());
+            moves.pop_front();
+            timeUntilNext += 1.0 / movesPerSecond;
+        }
+        // don't save up time while idle, so the next move is made straight away without a burst after it
+        if (moves.empty() && timeUntilNext < 0.0)
+        {
+            timeUntilNext = 0.0;
+        }
+    }
+};
+
+// declare number of pixel buffers that frames are read into, so a frame is only waited for once two more have been drawn
+const int PIXEL_BUFFER_COUNT = 3;
+
+// frame target class
+// an offscreen framebuffer that frames are drawn into and read back from, so that frames can be made without a window
+// frames are read into a ring of pixel buffers, so reading one back doesn't stall drawing the next
+class FrameTarget
+{
+private:
+    // declare variables
+    GLuint framebuffer;
+    GLuint colourBuffer;
+    GLuint depthBuffer;
+    GLuint pixelBuffers[PIXEL_BUFFER_COUNT];
+    int nextRead;
+    int pendingReads;
+public:
+    int width;
+    int height;
+
+    // constructor to create framebuffer with colour and depth buffers of the given size
+    FrameTarget(int width, int height)
+    {
+        this->width = width;
+        this->height = height;
+
+        glGenFramebuffers(1, &this->framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+
+        glGenRenderbuffers(1, &this->colourBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, this->colourBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, this->colourBuffer);
+
+        glGenRenderbuffers(1, &this->depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, this->depthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, this->depthBuffer);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            cout << "ERROR::FRAMETARGET::FRAMEBUFFER_NOT_COMPLETE" << endl;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        // create pixel buffers that each hold one frame of RGB pixels
+        glGenBuffers(PIXEL_BUFFER_COUNT, this->pixelBuffers);
+        for (int i = 0; i < PIXEL_BUFFER_COUNT; i++)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, this->pixelBuffers[i]);
+            glBufferData(GL_PIXEL_PACK_BUFFER, 3 * width * height, NULL, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        this->nextRead = 0;
+        this->pendingReads = 0;
+    }
+
+    // destructor to delete framebuffer and its buffers
+    ~FrameTarget()
+    {
+        glDeleteFramebuffers(1, &this->framebuffer);
+        glDeleteRenderbuffers(1, &this->colourBuffer);
+        glDeleteRenderbuffers(1, &this->depthBuffer);
+        glDeleteBuffers(PIXEL_BUFFER_COUNT, this->pixelBuffers);
+    }
+
+    // draw into framebuffer
+    void bind()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+        glViewport(0, 0, this->width, this->height);
+    }
+
+    // start reading the frame that was just drawn into the next pixel buffer, without waiting for it
+    // every pixel buffer must not be waiting to be finished
+    void startRead()
+    {
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, this->pixelBuffers[this->nextRead]);
+        glReadPixels(0, 0, this->width, this->height, GL_RGB, GL_UNSIGNED_BYTE, (GLvoid*)0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        this->nextRead = (this->nextRead + 1) % PIXEL_BUFFER_COUNT;
+        this->pendingReads++;
+    }
+
+    // check if every pixel buffer is waiting to be finished
+    bool isFull()
+    {
+        return this->pendingReads == PIXEL_BUFFER_COUNT;
+    }
+
+    // check if any pixel buffer is waiting to be finished
+    bool hasPendingReads()
+    {
+        return this->pendingReads > 0;
+    }
+
+    // finish the oldest read as RGB pixels, openGL reads from the bottom row up so rows are flipped to start from the top
+    void finishRead(vector <unsigned char>& pixels)
+    {
+        int rowSize = 3 * this->width;
+        pixels.resize(rowSize * this->height);
+        int oldest = (this->nextRead + PIXEL_BUFFER_COUNT - this->pendingReads) % PIXEL_BUFFER_COUNT;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, this->pixelBuffers[oldest]);
+        const unsigned char* rows = (const unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, rowSize * this->height, GL_MAP_READ_BIT);
+        if (rows != NULL)
+        {
+            for (int y = 0; y < this->height; y++)
+            {
+                memcpy(&pixels[y * rowSize], &rows[(this->height - 1 - y) * rowSize], rowSize);
+            }
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        this->pendingReads--;
+    }
+};
+
+// frame writer class
+// writes frames of RGB pixels, given from the top row down
+class FrameWriter
+{
+public:
+    virtual ~FrameWriter() {}
+    virtual bool writeFrame(const unsigned char* pixels) = 0;
+};
+
+// Y4M writer class
+// writes frames to one YUV4MPEG2 video with full resolution colour, which most video tools can read
+class Y4MWriter : public FrameWriter
+{
+private:
+    // declare variables
+    ofstream file;
+    int width;
+    int height;
+    vector <unsigned char> planes;
+public:
+    // constructor to open file and write stream header
+    Y4MWriter(string path, int width, int height, double frameRate)
+    {
+        this->width = width;
+        this->height = height;
+        planes.resize(3 * width * height);
+        file.open(path.c_str(), ios::binary);
+        file << "YUV4MPEG2 W" << width << " H" << height << " F" << (int)(frameRate * 1000.0 + 0.5) << ":1000 Ip A1:1 C444" << endl;
+    }
+
+    // convert frame to Y, U, and V planes and write it
+    bool writeFrame(const unsigned char* pixels)
+    {
+        int size = width * height;
+        for (int i = 0; i < size; i++)
+        {
+            int r = pixels[3 * i];
+            int g = pixels[3 * i + 1];
+            int b = pixels[3 * i + 2];
+            planes[i] = ((66 * r + 129 * g + 25 * b + 128) >> 8) + 16;
+            planes[size + i] = ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128;
+            planes[2 * size + i] = ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128;
+        }
+        file << "FRAME" << endl;
+        file.write((const char*)planes.data(), planes.size());
+        return (bool)file;
+    }
+};
+
+// raw writer class
+// writes frames one after another as raw RGB, with nothing else in the file
+class RawWriter : public FrameWriter
+{
+private:
+    // declare variables
+    ofstream file;
+    int frameSize;
+public:
+    // constructor to open file
+    RawWriter(string path, int width, int height)
+    {
+        frameSize = 3 * width * height;
+        file.open(path.c_str(), ios::binary);
+    }
+
+    // write frame
+    bool writeFrame(const unsigned char* pixels)
+    {
+        file.write((const char*)pixels, frameSize);
+        return (bool)file;
+    }
+};
+
+// declare table used to find CRC-32 of PNG chunks
+unsigned int crcTable[256];
+
+// generate CRC-32 table
+void initCrcTable()
+{
+    for (unsigned int i = 0; i < 256; i++)
+    {
+        unsigned int crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = crc & 1 ? 0xEDB88320 ^ (crc >> 1) : crc >> 1;
+        }
+        crcTable[i] = crc;
+    }
+}
+
+// PNG writer class
+// writes each frame to its own numbered PNG image, stored without compression so that writing stays fast
+class PNGWriter : public FrameWriter
+{
+private:
+    // declare variables
+    string prefix;
+    int width;
+    int height;
+    int frame;
+    string data;
+
+    // append a big endian number
+    static void appendNumber(string& bytes, unsigned int number)
+    {
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            bytes += (char)(number >> shift);
+        }
+    }
+
+    // append a chunk with its length and CRC-32
+    static void appendChunk(string& bytes, const char* type, const string& contents)
+    {
+        appendNumber(bytes, contents.size());
+        string chunk = type + contents;
+        unsigned int crc = 0xFFFFFFFF;
+        for (int i = 0; i < (int)chunk.size(); i++)
+        {
+            crc = crcTable[(crc ^ (unsigned char)chunk[i]) & 0xFF] ^ (crc >> 8);
+        }
+        bytes += chunk;
+        appendNumber(bytes, crc ^ 0xFFFFFFFF);
+    }
+public:
+    // constructor to find prefix of image names
+    PNGWriter(string path, int width, int height)
+    {
+        prefix = path.substr(0, path.size() - 4);
+        this->width = width;
+        this->height = height;
+        frame = 0;
+        if (crcTable[1] == 0)
+        {
+            initCrcTable();
+        }
+    }
+
+    // write frame to next image
+    bool writeFrame(const unsigned char* pixels)
+    {
+        // rows of pixels, each starting with a byte that says no filter is used
+        int rowSize = 3 * width;
+        string rows;
+        for (int y = 0; y < height; y++)
+        {
+            rows += '\0';
+            rows.append((const char*)pixels + y * rowSize, rowSize);
+        }
+
+        // zlib stream of stored blocks, each of which holds up to 65535 bytes
+        data = "\x78\x01";
+        unsigned int a = 1;
+        unsigned int b = 0;
+        for (int i = 0; i < (int)rows.size(); i += 65535)
+        {
+            int length = min((int)rows.size() - i, 65535);
+            data += (char)(i + length == (int)rows.size() ? 1 : 0);
+            data += (char)(length & 0xFF);
+            data += (char)(length >> 8);
+            data += (char)(~length & 0xFF);
+            data += (char)((~length >> 8) & 0xFF);
+            data.append(rows, i, length);
+            for (int j = i; j < i + length; j++)
+            {
+                a = (a + (unsigned char)rows[j]) % 65521;
+                b = (b + a) % 65521;
+            }
+        }
+        appendNumber(data, (b << 16) | a);
+
+        // image header of 8 bit RGB, then the data
+        string header;
+        appendNumber(header, width);
+        appendNumber(header, height);
+        header += string("\x08\x02\x00\x00\x00", 5);
+        string png = "\x89PNG\r\n\x1A\n";
+        appendChunk(png, "IHDR", header);
+        appendChunk(png, "IDAT", data);
+        appendChunk(png, "IEND", "");
+
+        char number[16];
+        snprintf(number, sizeof(number), "_%05d.png", frame);
+        frame++;
+        ofstream file((prefix + number).c_str(), ios::binary);
+        file.write(png.data(), png.size());
+        return (bool)file;
+    }
+};
+
+// open writer for a path, a .y4m path is written as one video, a .rgb path as raw video, and a .png path as numbered images
+FrameWriter* openFrameWriter(string path, int width, int height, double frameRate)
+{
+    string extension = path.size() >= 4 ? path.substr(path.size() - 4) : "";
+    if (extension == ".y4m")
+    {
+        return new Y4MWriter(path, width, height, frameRate);
+    }
+    if (extension == ".rgb")
+    {
+        return new RawWriter(path, width, height);
+    }
+    if (extension == ".png")
+    {
+        return new PNGWriter(path, width, height);
+    }
+    cout << "ERROR::FRAMES::UNKNOWN_FORMAT" << endl;
+    return NULL;
+}
+
+// write playback of a plan from a cube state, drawn offscreen at a fixed frame rate instead of the clock
+// so it is written as fast as it can be drawn, the renderer is a copy of the one that draws the cube state
+void recordPlayback(CubeState cube, CubeRenderer renderer, const vector <Move>& plan, CubeMesh& mesh, const ShaderUniforms& uniforms,
+                    const glm::mat4& viewProj, string path, int width, int height, double frameRate, double movesPerSecond)
+{
+    FrameWriter* writer = openFrameWriter(path, width, height, frameRate);
+    if (writer == NULL)
+    {
+        return;
+    }
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    FrameTarget target(width, height);
+    target.bind();
+
+    // play plan on copies of cube state and renderer
+    cube.observer = &renderer;
+    MoveScheduler scheduler(movesPerSecond);
+    scheduler.push(plan);
+
+    // the first frame shows the cube before the plan, and the last shows the final turn finished
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    vector <unsigned char> pixels;
+    int frames = 0;
+    bool written = true;
+    do
+    {
+        if (frames > 0)
+        {
+            scheduler.update(cube, 1.0 / frameRate);
+        }
+        renderCubes(mesh, uniforms, viewProj, renderer, scheduler.getTurnProgress());
+        target.startRead();
+        frames++;
+
+        // write oldest frame once every pixel buffer is in use, by then it has usually been read
+        if (target.isFull())
+        {
+            target.finishRead(pixels);
+            written = writer->writeFrame(pixels.data()) && written;
+        }
+    } while (!scheduler.isIdle());
+    while (target.hasPendingReads())
+    {
+        target.finishRead(pixels);
+        written = writer->writeFrame(pixels.data()) && written;
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    delete writer;
+
+    // draw into the window again
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+    if (!written)
+    {
+        cout << "ERROR::FRAMES::COULD_NOT_WRITE_FRAME" << endl;
+        return;
+    }
+    cout << "Wrote " << frames << " frames to " << path << " in " << seconds << " seconds (" << frames / seconds << " frames per second)" << endl;
+}
+
+// solve recorder class
+// writes each solution played in the window to its own numbered file, before it starts to play
+class SolveRecorder
+{
+private:
+    // declare variables
+    CubeMesh& mesh;
+    const ShaderUniforms& uniforms;
+    const CubeRenderer& renderer;
+    glm::mat4 viewProj;
+    string path;
+    int width;
+    int height;
+    double frameRate;
+    double movesPerSecond;
+    int solves;
+public:
+    // constructor
+    SolveRecorder(CubeMesh& mesh, const ShaderUniforms& uniforms, const CubeRenderer& renderer, const glm::mat4& viewProj,
+                  string path, int width, int height, double frameRate, double movesPerSecond)
+        : mesh(mesh), uniforms(uniforms), renderer(renderer)
+    {
+        this->viewProj = viewProj;
+        this->path = path;
+        this->width = width;
+        this->height = height;
+        this->frameRate = frameRate;
+        this->movesPerSecond = movesPerSecond;
+        solves = 0;
+    }
+
+    // record solution of cube, numbering the file before its extension
+    void record(const CubeState& cube, const vector <Move>& plan)
+    {
+        solves++;
+        char number[16];
+        snprintf(number, sizeof(number), "_%03d", solves);
+        size_t extension = path.find_last_of('.');
+        string solvePath = extension == string::npos ? path + number : path.substr(0, extension) + number + path.substr(extension);
+        recordPlayback(cube, renderer, plan, mesh, uniforms, viewProj, solvePath, width, height, frameRate, movesPerSecond);
+    }
+};
+
+// solve cube, recording the solution first if a recorder is given
+void solveCube(CubeState& cube, MoveScheduler& scheduler, SolveRecorder* recorder)
+{
+    // plan solution first, then queue it to be animated
+    double startTime = glfwGetTime();
+    vector <Move> plan = planSolution(cube);
+    cout << "Found " << plan.size() << " move solution in " << glfwGetTime() - startTime << " seconds" << endl;
+    if (recorder != NULL)
+    {
+        recorder->record(cube, plan);
+    }
+    scheduler.push(plan);
+}
+
+// benchmark solution length and time of the selected solver
+void benchmarkSolve()
+{
+    // optimal solutions of random cubes take far longer, so fewer and shorter scrambles are used
+    const int CUBE_COUNT = solver == OPTIMAL ? 10 : 100;
+    const int SCRAMBLE_LENGTH = solver == OPTIMAL ? 12 : 25;
+
+    // time table generation separately from solving, benchmarks run before GLFW is initialized so its clock can't be used
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    if (solver == OPTIMAL)
+    {
+        initOptimalTables();
+        cout << "Generated pattern databases in " << chrono::duration<double>(chrono::steady_clock::now() - start).count() << " seconds" << endl;
+    }
+    else if (solver == TWO_PHASE)
+    {
+        initTwoPhaseTables();
+        cout << "Generated two-phase tables in " << chrono::duration<double>(chrono::steady_clock::now() - start).count() << " seconds" << endl;
+    }
+
+    // solve scrambled cubes
+    int totalLength = 0;
+    int longest = 0;
+    int failed = 0;
+    double totalTime = 0.0;
+    double slowest = 0.0;
+    for (int i = 0; i < CUBE_COUNT; i++)
+    {
+        Move scramble[SCRAMBLE_LENGTH];
+        generateScramble(randomGenerator, scramble, SCRAMBLE_LENGTH);
+        CubeState cube;
+        for (int j = 0; j < SCRAMBLE_LENGTH; j++)
+        {
+            applyMove(cube, scramble[j]);
+        }
+        start = chrono::steady_clock::now();
+        vector <Move> solution = planSolution(cube);
+        double time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        // check solution by replaying it with the batch kernel
+        if (countSolvedBatch(vector <PackedCube>(1, packCube(cube)), solution) != 1)
+        {
+            failed++;
+        }
+        totalLength += solution.size();
+        longest = max(longest, (int)solution.size());
+        totalTime += time;
+        slowest = max(slowest, time);
+    }
+
+    cout << "Solved " << CUBE_COUNT << " cubes scrambled with " << SCRAMBLE_LENGTH << " moves" << endl;
+    cout << "Average length: " << (double)totalLength / CUBE_COUNT << " moves, longest: " << longest << " moves" << endl;
+    cout << "Average time: " << totalTime / CUBE_COUNT * 1000.0 << " ms, slowest: " << slowest * 1000.0 << " ms" << endl;
+    if (failed > 0)
+    {
+        cout << "ERROR::SOLVER::" << failed << "_SOLUTIONS_FAILED" << endl;
+    }
+}
+
+// scramble cube
+void scrambleCube(CubeState& cube)
+{
+    // generate moves to a random state
+    Move moves[MAX_SCRAMBLE_LENGTH];
+    int length = generateRandomStateScramble(randomGenerator, moves);
+
+    // perform generated moves
+    for (int i = 0; i < length; i++)
+    {
+        applyMove(cube, moves[i]);
+    }
+}
+
+// key event structure
+struct KeyEvent
+{
+    int key;
+    int mods;
+    bool repeat;
+};
+
+// key binding structure
+struct KeyBinding
+{
+    int key;
+    int layer;
+    int degree; // degree without modifiers, modifiers only change face and slice turns
+};
+
+// declare key bindings
+const KeyBinding keyBindings[] =
+{
+    { GLFW_KEY_W, U_FACE, 1 },
+    { GLFW_KEY_S, D_FACE, 1 },
+    { GLFW_KEY_A, L_FACE, 1 },
+    { GLFW_KEY_D, R_FACE, 1 },
+    { GLFW_KEY_E, F_FACE, 1 },
+    { GLFW_KEY_Q, B_FACE, 1 },
+    { GLFW_KEY_Z, M_SLICE, 1 },
+    { GLFW_KEY_X, E_SLICE, 1 },
+    { GLFW_KEY_C, S_SLICE, 1 },
+    { GLFW_KEY_8, X_AXIS, 1 },
+    { GLFW_KEY_KP_8, X_AXIS, 1 },
+    { GLFW_KEY_2, X_AXIS, 3 },
+    { GLFW_KEY_KP_2, X_AXIS, 3 },
+    { GLFW_KEY_4, Y_AXIS, 1 },
+    { GLFW_KEY_KP_4, Y_AXIS, 1 },
+    { GLFW_KEY_6, Y_AXIS, 3 },
+    { GLFW_KEY_KP_6, Y_AXIS, 3 },
+    { GLFW_KEY_9, Z_AXIS, 1 },
+    { GLFW_KEY_KP_9, Z_AXIS, 1 },
+    { GLFW_KEY_7, Z_AXIS, 3 },
+    { GLFW_KEY_KP_7, Z_AXIS, 3 }
+};
+
+// declare key events waiting to be handled
+deque <KeyEvent> keyEvents;
+
+// redraw cube when the window has been uncovered or resized
+void windowRefreshCallback(GLFWwindow* window)
+{
+    CubeRenderer* renderer = (CubeRenderer*)glfwGetWindowUserPointer(window);
+    renderer->dirty = true;
+}
+
+// queue key presses as they happen, so none are lost between frames
+void keyCallback(GLFWwindow* window, int key, int /*scancode*/, int action, int mods)
+{
+    // exit window straight away
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+    {
+        glfwSetWindowShouldClose(window, GLFW_TRUE);
+        return;
+    }
+    // held keys repeat turns, but not solves or scrambles
+    if (action == GLFW_PRESS || (action == GLFW_REPEAT && key != GLFW_KEY_ENTER && key != GLFW_KEY_SPACE))
+    {
+        KeyEvent event = { key, mods, action == GLFW_REPEAT };
+        keyEvents.push_back(event);
+    }
+}
+
+// find move of a key, if it has one
+bool getKeyMove(const KeyEvent& event, Move& move)
+{
+    for (int i = 0; i < (int)(sizeof(keyBindings) / sizeof(keyBindings[0])); i++)
+    {
+        if (keyBindings[i].key == event.key)
+        {
+            int degree = keyBindings[i].degree;
+            if (keyBindings[i].layer < X_AXIS)
+            {
+                // control makes a half turn and shift makes a counter-clockwise turn
+                if (event.mods & GLFW_MOD_CONTROL)
+                {
+                    degree = 2;
+                }
+                else if (event.mods & GLFW_MOD_SHIFT)
+                {
+                    degree = 3;
+                }
+            }
+            move = makeMove(keyBindings[i].layer, degree);
+            return true;
+        }
+    }
+    return false;
+}
+
+// update input
+void updateInput(CubeState& cube, MoveScheduler& scheduler, SolveRecorder* recorder)
+{
+    // handle key presses in order
+    while (!keyEvents.empty())
+    {
+        KeyEvent event = keyEvents.front();
+        Move move;
+        if (getKeyMove(event, move))
+        {
+            // held keys repeat faster than moves play, so a repeat is only queued once earlier moves have started
+            // and turning stops soon after the key is let go, presses are always queued
+            if (!event.repeat || !scheduler.hasQueuedMoves())
+            {
+                scheduler.push(move);
+            }
+        }
+        else if (event.key == GLFW_KEY_ENTER || event.key == GLFW_KEY_SPACE)
+        {
+            // solving and scrambling start from the state after every queued move, so leave them and any later keys
+            // in the queue until the moves are done
+            if (!scheduler.isIdle())
+            {
+                return;
+            }
+            if (event.key == GLFW_KEY_ENTER)
+            {
+                solveCube(cube, scheduler, recorder);
+            }
+            else
+            {
+                scrambleCube(cube);
+            }
+        }
+        keyEvents.pop_front();
+    }
+}
+
+// declare names of pieces in vertices.txt, in the order pieces are numbered
+const string pieceNames[26] =
+{
+    "UCentre", "LCentre", "FCentre", "RCentre", "BCentre", "DCentre",
+    "UFEdge", "UBEdge", "DBEdge", "DFEdge", "LFEdge", "RFEdge", "RBEdge", "LBEdge", "LUEdge", "RUEdge", "RDEdge", "LDEdge",
+    "LUBCorner", "RUBCorner", "RUFCorner", "LUFCorner", "LDBCorner", "RDBCorner", "RDFCorner", "LDFCorner"
+};
+
+// declare number of vertices of a piece, four for each of its six squares
+const int PIECE_VERTEX_COUNT = 24;
+
+// geometry file header structure
+// followed by the x, y, and z of every vertex of every piece, in the order pieces are numbered
+struct GeometryHeader
+{
+    char magic[4];
+    int pieceCount;
+    int pieceVertexCount;
+};
+
+// declare magic bytes at the start of a geometry file
+const char GEOMETRY_MAGIC[4] = { 'R', 'C', 'G', '1' };
+
+// read a whole file in one go
+bool readFile(string path, string& contents)
+{
+    ifstream file(path.c_str(), ios::binary | ios::ate);
+    if (!file)
+    {
+        return false;
+    }
+    contents.resize(file.tellg());
+    file.seekg(0);
+    file.read(&contents[0], contents.size());
+    return (bool)file;
+}
+
+// parse a float that ends before lineEnd and skip the f that may follow it
+// strtof would skip a newline to find a number, so leading spaces are skipped here and the number must start on the line
+bool parseFloat(const char*& text, const char* lineEnd, float& value)
+{
+    while (text < lineEnd && (*text == ' ' || *text == '\t'))
+    {
+        text++;
+    }
+    if (text == lineEnd || *text == '\r')
+    {
+        return false;
+    }
+    char* end;
+    value = strtof(text, &end);
+    if (end == text || end > lineEnd)
+    {
+        return false;
+    }
+    text = end;
+    if (*text == 'f')
+    {
+        text++;
+    }
+    return true;
+}
+
+// load vertices of every piece from text file, in one pass over the file
+bool loadVerticesText(string path, vector < vector <glm::vec3> >* pieceVertices)
+{
+    string contents;
+    if (!readFile(path, contents))
+    {
+        cout << "ERROR::LOADVERTICES::COULD_NOT_OPEN_FILE" << endl;
+        return false;
+    }
+
+    // a line starting with a letter names a piece, and the lines after it are its vertices
+    int piece = -1;
+    int vertexCounts[26] = { 0 };
+    const char* line = contents.c_str();
+    while (*line != '\0')
+    {
+        const char* lineEnd = strchr(line, '\n');
+        if (lineEnd == NULL)
+        {
+            lineEnd = line + strlen(line);
+        }
+        if (isalpha(*line))
+        {
+            string name(line, lineEnd);
+            name.erase(name.find_last_not_of(" \r") + 1);
+            piece = find(pieceNames, pieceNames + 26, name) - pieceNames;
+            if (piece < 26)
+            {
+                pieceVertices[piece].assign(6, vector <glm::vec3>());
+                vertexCounts[piece] = 0;
+            }
+        }
+        else if (line + strspn(line, " \t\r") < lineEnd)
         {
-            turnFFace(2, pieces, edgeStickers, cornerStickers, rotation);
+            // vertices must follow the name of a known piece and have three coordinates on their own line
+            if (piece < 0 || piece >= 26)
+            {
+                cout << "ERROR::LOADVERTICES::VERTEX_OUTSIDE_PIECE" << endl;
+                return false;
+            }
+            glm::vec3 vertex;
+            const char* text = line;
+            if (!parseFloat(text, lineEnd, vertex.x) || !parseFloat(text, lineEnd, vertex.y) || !parseFloat(text, lineEnd, vertex.z))
+            {
+                cout << "ERROR::LOADVERTICES::VERTEX_NOT_VALID_IN_" << pieceNames[piece] << endl;
+                return false;
+            }
+            if (vertexCounts[piece] < PIECE_VERTEX_COUNT)
+            {
+                pieceVertices[piece][vertexCounts[piece] / 4].push_back(vertex);
+                vertexCounts[piece]++;
+            }
         }
-        else if (moves[i] == 15)
+        line = *lineEnd == '\0' ? lineEnd : lineEnd + 1;
+    }
+
+    // every piece must have all of its vertices
+    for (int i = 0; i < 26; i++)
+    {
+        if (vertexCounts[i] != PIECE_VERTEX_COUNT)
         {
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
+            cout << "ERROR::LOADVERTICES::MISSING_VERTICES_OF_" << pieceNames[i] << endl;
+            return false;
         }
-        else if (moves[i] == 16)
+    }
+    return true;
+}
+
+// load vertices of every piece from binary geometry file
+bool loadVerticesBinary(string path, vector < vector <glm::vec3> >* pieceVertices)
+{
+    string contents;
+    if (!readFile(path, contents))
+    {
+        return false;
+    }
+
+    // the file must hold a matching header and exactly the vertices it describes
+    GeometryHeader header;
+    size_t dataSize = 26 * PIECE_VERTEX_COUNT * 3 * sizeof(float);
+    if (contents.size() >= sizeof(header))
+    {
+        memcpy(&header, contents.data(), sizeof(header));
+    }
+    if (contents.size() != sizeof(header) + dataSize || memcmp(header.magic, GEOMETRY_MAGIC, 4) != 0 ||
+        header.pieceCount != 26 || header.pieceVertexCount != PIECE_VERTEX_COUNT)
+    {
+        cout << "ERROR::GEOMETRY::FILE_NOT_VALID" << endl;
+        return false;
+    }
+
+    const float* data = (const float*)(contents.data() + sizeof(header));
+    for (int i = 0; i < 26; i++)
+    {
+        pieceVertices[i].assign(6, vector <glm::vec3>());
+        for (int j = 0; j < PIECE_VERTEX_COUNT; j++)
         {
-            turnBFace(1, pieces, edgeStickers, cornerStickers, rotation);
+            pieceVertices[i][j / 4].push_back(glm::vec3(data[0], data[1], data[2]));
+            data += 3;
         }
-        else if (moves[i] == 17)
+    }
+    return true;
+}
+
+// save vertices of every piece to binary geometry file
+void saveVerticesBinary(string path, const vector < vector <glm::vec3> >* pieceVertices)
+{
+    GeometryHeader header;
+    memcpy(header.magic, GEOMETRY_MAGIC, 4);
+    header.pieceCount = 26;
+    header.pieceVertexCount = PIECE_VERTEX_COUNT;
+    vector <float> data;
+    for (int i = 0; i < 26; i++)
+    {
+        for (int j = 0; j < PIECE_VERTEX_COUNT; j++)
         {
-            turnBFace(2, pieces, edgeStickers, cornerStickers, rotation);
+            const glm::vec3& vertex = pieceVertices[i][j / 4][j % 4];
+            data.push_back(vertex.x);
+            data.push_back(vertex.y);
+            data.push_back(vertex.z);
         }
-        else if (moves[i] == 18)
+    }
+
+    ofstream file(path.c_str(), ios::binary);
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)data.data(), data.size() * sizeof(float));
+    if (!file)
+    {
+        cout << "ERROR::GEOMETRY::FILE_NOT_WRITTEN" << endl;
+    }
+}
+
+// convert vertices.txt to vertices.bin, reporting how long each takes to load
+void convertVertices()
+{
+    vector < vector <glm::vec3> > pieceVertices[26];
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    if (!loadVerticesText("vertices.txt", pieceVertices))
+    {
+        return;
+    }
+    double textSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    saveVerticesBinary("vertices.bin", pieceVertices);
+
+    start = chrono::steady_clock::now();
+    if (!loadVerticesBinary("vertices.bin", pieceVertices))
+    {
+        return;
+    }
+    double binarySeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "Wrote vertices.bin" << endl;
+    cout << "vertices.txt loads in " << textSeconds * 1000.0 << " ms" << endl;
+    cout << "vertices.bin loads in " << binarySeconds * 1000.0 << " ms" << endl;
+}
+
+// declare width of a piece
+const float PIECE_SIZE = 0.3f;
+
+// declare corners of each square of a piece, as directions from its centre, in the same order and winding as vertices.txt
+const float squareCorners[6][4][3] =
+{
+    { { -1, 1, 1 }, { 1, 1, 1 }, { 1, 1, -1 }, { -1, 1, -1 } },
+    { { -1, -1, -1 }, { 1, -1, -1 }, { 1, -1, 1 }, { -1, -1, 1 } },
+    { { -1, -1, -1 }, { -1, -1, 1 }, { -1, 1, 1 }, { -1, 1, -1 } },
+    { { 1, -1, 1 }, { 1, -1, -1 }, { 1, 1, -1 }, { 1, 1, 1 } },
+    { { -1, -1, 1 }, { 1, -1, 1 }, { 1, 1, 1 }, { -1, 1, 1 } },
+    { { -1, 1, -1 }, { 1, 1, -1 }, { 1, -1, -1 }, { -1, -1, -1 } }
+};
+
+// declare position of each piece of a 3 x 3 x 3 cube, in pieces from the centre, in the order pieces are numbered
+const int piecePositions[26][3] =
+{
+    { 0, 1, 0 }, { -1, 0, 0 }, { 0, 0, 1 }, { 1, 0, 0 }, { 0, 0, -1 }, { 0, -1, 0 },
+    { 0, 1, 1 }, { 0, 1, -1 }, { 0, -1, -1 }, { 0, -1, 1 }, { -1, 0, 1 }, { 1, 0, 1 },
+    { 1, 0, -1 }, { -1, 0, -1 }, { -1, 1, 0 }, { 1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+    { -1, 1, -1 }, { 1, 1, -1 }, { 1, 1, 1 }, { -1, 1, 1 }, { -1, -1, -1 }, { 1, -1, -1 }, { 1, -1, 1 }, { -1, -1, 1 }
+};
+
+// generate squares of a piece centred on a position
+vector < vector <glm::vec3> > generatePieceVertices(glm::vec3 centre, float pieceSize)
+{
+    vector < vector <glm::vec3> > vertices(6);
+    for (int i = 0; i < 6; i++)
+    {
+        for (int j = 0; j < 4; j++)
         {
-            turnBFace(3, pieces, edgeStickers, cornerStickers, rotation);
+            const float* corner = squareCorners[i][j];
+            vertices[i].push_back(centre + glm::vec3(corner[0], corner[1], corner[2]) * (pieceSize * 0.5f));
         }
     }
+    return vertices;
+}
+
+// generate vertices of every piece of the cube, in the order pieces are numbered in
+// only a 3 x 3 x 3 cube is generated, since the cube state, moves, and shader all hold exactly 26 pieces
+void generateCubeVertices(float pieceSize, vector < vector < vector <glm::vec3> > >& pieceVertices)
+{
+    pieceVertices.clear();
+    for (int i = 0; i < 26; i++)
+    {
+        glm::vec3 centre(piecePositions[i][0], piecePositions[i][1], piecePositions[i][2]);
+        pieceVertices.push_back(generatePieceVertices(centre * pieceSize, pieceSize));
+    }
+}
+
+// declare source of vertex shader
+const char* vertexShaderSource = R"(#version 330
+
+layout (location = 0) in vec3 vertex_position;
+layout (location = 1) in vec4 vertex_colour;
+layout (location = 2) in vec2 vertex_uv;
+layout (location = 3) in int vertex_piece;
+
+out vec4 vs_colour;
+out vec2 vs_uv;
+
+uniform mat4 viewProj;
+
+layout (std140) uniform Pieces
+{
+    mat4 models[26];
+};
+
+// layer that is part way through a turn, with a bit set in the mask for each of its pieces
+uniform vec3 turnAxis;
+uniform int turnMask;
+uniform float turnAngle;
+
+// rotate a point about an axis through the centre of the cube, the same way as the rotation functions of the program
+vec3 rotateAboutAxis(vec3 point, vec3 axis, float angle)
+{
+    float c = cos(angle);
+    float s = -sin(angle);
+    return point * c + cross(axis, point) * s + axis * dot(axis, point) * (1.0f - c);
+}
+
+void main()
+{
+    vs_colour = vertex_colour;
+    vs_uv = vertex_uv;
+
+    vec4 position = models[vertex_piece] * vec4(vertex_position, 1.0f);
+    if (((turnMask >> vertex_piece) & 1) != 0)
+    {
+        position.xyz = rotateAboutAxis(position.xyz, turnAxis, turnAngle);
+    }
+
+    gl_Position = viewProj * position;
+}
+)";
+
+// declare source of fragment shader
+const char* fragmentShaderSource = R"(#version 330
+
+in vec4 vs_colour;
+in vec2 vs_uv;
+
+out vec4 fs_colour;
+
+// width of the outline as a fraction of a square
+const float borderWidth = 0.04f;
+const vec4 borderColour = vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+void main()
+{
+    // distance to the nearest edge of the square, smoothed over about a pixel so the outline stays crisp at any size
+    vec2 edgeDistance = min(vs_uv, 1.0f - vs_uv);
+    float edge = min(edgeDistance.x, edgeDistance.y);
+    float pixel = fwidth(edge);
+    float sticker = smoothstep(borderWidth - pixel, borderWidth + pixel, edge);
+
+    fs_colour = mix(borderColour, vs_colour, sticker);
+}
+)";
+
+// declare file that linked shader programs are cached in
+const string SHADER_CACHE_PATH = "shaders.bin";
+
+// shader cache header structure
+// followed by the program binary
+struct ShaderCacheHeader
+{
+    char magic[4];
+    unsigned long long key;
+    GLenum binaryFormat;
+    GLint binaryLength;
+};
+
+// declare magic bytes at the start of a shader cache file
+const char SHADER_CACHE_MAGIC[4] = { 'R', 'C', 'S', '1' };
+
+// hash bytes with 64 bit FNV-1a
+unsigned long long hashBytes(const string& bytes, unsigned long long hash = 14695981039346656037ULL)
+{
+    for (int i = 0; i < (int)bytes.size(); i++)
+    {
+        hash = (hash ^ (unsigned char)bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// find key of cached program, a cached binary only works with the same driver and the same sources
+unsigned long long getShaderCacheKey()
+{
+    string key = "";
+    GLenum names[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+    for (int i = 0; i < 3; i++)
+    {
+        const GLubyte* value = glGetString(names[i]);
+        key += value != NULL ? (const char*)value : "";
+        key += '\n';
+    }
+    key += vertexShaderSource;
+    key += fragmentShaderSource;
+    return hashBytes(key);
+}
+
+// check that the driver can save and load program binaries
+bool canCacheShaders()
+{
+    if (!GLEW_ARB_get_program_binary)
+    {
+        return false;
+    }
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    return formatCount > 0;
+}
+
+// load linked program from cache
+bool loadProgramBinary(GLuint program, unsigned long long key)
+{
+    string contents;
+    if (!readFile(SHADER_CACHE_PATH, contents))
+    {
+        return false;
+    }
+    ShaderCacheHeader header;
+    if (contents.size() < sizeof(header))
+    {
+        return false;
+    }
+    memcpy(&header, contents.data(), sizeof(header));
+    if (memcmp(header.magic, SHADER_CACHE_MAGIC, 4) != 0 || header.key != key || contents.size() != sizeof(header) + header.binaryLength)
+    {
+        return false;
+    }
+
+    // the driver can still refuse a binary, in which case the program is compiled again
+    glProgramBinary(program, header.binaryFormat, contents.data() + sizeof(header), header.binaryLength);
+    GLint success = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    return success == GL_TRUE;
+}
+
+// save linked program to cache
+void saveProgramBinary(GLuint program, unsigned long long key)
+{
+    // value initialize so padding bytes written to the file are zero
+    ShaderCacheHeader header = {};
+    memcpy(header.magic, SHADER_CACHE_MAGIC, 4);
+    header.key = key;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &header.binaryLength);
+    if (header.binaryLength <= 0)
+    {
+        return;
+    }
+
+    // don't cache a binary the driver failed to give back
+    vector <char> binary(header.binaryLength);
+    GLsizei length = 0;
+    // clear earlier errors, so any error seen after the query is its own
+    while (glGetError() != GL_NO_ERROR)
+    {
+    }
+    glGetProgramBinary(program, header.binaryLength, &length, &header.binaryFormat, binary.data());
+    if (glGetError() != GL_NO_ERROR || length != header.binaryLength)
+    {
+        return;
+    }
+
+    ofstream file(SHADER_CACHE_PATH.c_str(), ios::binary);
+    file.write((const char*)&header, sizeof(header));
+    file.write(binary.data(), binary.size());
+    if (!file)
+    {
+        cout << "ERROR::SHADERCACHE::FILE_NOT_WRITTEN" << endl;
+    }
+}
+
+// compile shader from source
+bool compileShader(GLuint shader, const char* source, string error)
+{
+    char infoLog[512];
+    GLint success = GL_FALSE;
+
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (success == false)
+    {
+        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        cout << error << endl;
+        cout << infoLog << endl;
+        return false;
+    }
+    return true;
+}
+
+// load shaders, from the program cache if it was saved by the same driver from the same sources
+bool loadShaders(GLuint& program)
+{
+    // declare variables
+    bool loadSuccess = true;
+    char infoLog[512];
+    GLint success;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    // create program and try cache
+    program = glCreateProgram();
+    bool useCache = canCacheShaders();
+    unsigned long long cacheKey = useCache ? getShaderCacheKey() : 0;
+    if (useCache && loadProgramBinary(program, cacheKey))
+    {
+        cout << "Loaded shaders from cache in " << chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000.0 << " ms" << endl;
+        return true;
+    }
+
+    // compile shaders
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    loadSuccess = compileShader(vertexShader, vertexShaderSource, "ERROR::LOADSHADERS::COULD_NOT_COMPILE_VERTEX_SHADER") && loadSuccess;
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    loadSuccess = compileShader(fragmentShader, fragmentShaderSource, "ERROR::LOADSHADERS::COULD_NOT_COMPILE_FRAGMENT_SHADER") && loadSuccess;
+
+    // attach shaders and link program, asking the driver to keep its binary so it can be cached
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    if (useCache)
+    {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    glLinkProgram(program);
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (success == false)
+    {
+        glGetProgramInfoLog(program, 512, NULL, infoLog);
+        loadSuccess = false;
+        cout << "ERROR::LOADSHADERS::COULD_NOT_LINK_PROGRAM" << endl;
+        cout << infoLog << endl;
+    }
+    else if (useCache)
+    {
+        saveProgramBinary(program, cacheKey);
+    }
+
+    // end
+    glUseProgram(0);
+    glDetachShader(program, vertexShader);
+    glDetachShader(program, fragmentShader);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    cout << "Compiled shaders in " << chrono::duration<double>(chrono::steady_clock::now() - start).count() * 1000.0 << " ms" << endl;
+    return loadSuccess;
 }
 
-// update input
-void updateInput(GLFWwindow* window, int(&pieces)[26], int(&edgeStickers)[24], int(&cornerStickers)[24], glm::mat4(&rotation)[26], Cube* cubes, GLuint core_program, glm::mat4 proj, glm::mat4 view)
+// look up uniforms of shader program
+ShaderUniforms getShaderUniforms(GLuint program)
 {
-    // exit window
-    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    ShaderUniforms uniforms;
+    uniforms.viewProj = glGetUniformLocation(program, "viewProj");
+    uniforms.turnAxis = glGetUniformLocation(program, "turnAxis");
+    uniforms.turnMask = glGetUniformLocation(program, "turnMask");
+    uniforms.turnAngle = glGetUniformLocation(program, "turnAngle");
+
+    // read model matrices from the uniform buffer of the cube mesh
+    GLuint pieceBlock = glGetUniformBlockIndex(program, "Pieces");
+    if (pieceBlock == GL_INVALID_INDEX)
     {
-        glfwSetWindowShouldClose(window, GLFW_TRUE);
+        cout << "ERROR::GETSHADERUNIFORMS::COULD_NOT_FIND_PIECES_BLOCK" << endl;
     }
-    // turn U face
-    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
+    else
     {
-        // U2 move
-        if (glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
-        {
-            turnUFace(2, pieces, edgeStickers, cornerStickers, rotation);
-        }
-        // U' move
-        else if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
-        {
-            turnUFace(3, pieces, edgeStickers, cornerStickers, rotation);
-        }
-        // U move
-        else
-        {
-            turnUFace(1, pieces, edgeStickers, cornerStickers, rotation);
-        }
-        delay(0.2);
+        glUniformBlockBinding(program, pieceBlock, PIECE_BLOCK_BINDING);
     }
-    // turn D face
-    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
+
+    return uniforms;
+}
+
+// scramble a cube and write every frame of its solution, drawn into an offscreen framebuffer instead of a window
+void renderSolveFrames(CubeMesh& mesh, const ShaderUniforms& uniforms, const glm::mat4& viewProj, string path, int width, int height, double frameRate, double movesPerSecond)
+{
+    CubeState cube;
+    CubeRenderer renderer;
+    cube.observer = &renderer;
+    scrambleCube(cube);
+    recordPlayback(cube, renderer, planSolution(cube), mesh, uniforms, viewProj, path, width, height, frameRate, movesPerSecond);
+}
+
+// get the value that a fraction of sorted times are no longer than
+double percentile(const vector <double>& sortedTimes, double fraction)
+{
+    int index = (int)(fraction * sortedTimes.size());
+    return sortedTimes[min(index, (int)sortedTimes.size() - 1)];
+}
+
+// benchmark time to draw and present frames of a cube that keeps turning, without waiting for vertical sync
+// prints one line of name=value pairs in milliseconds so runs can be compared by scripts
+void benchmarkRender(GLFWwindow* window, CubeMesh& mesh, const ShaderUniforms& uniforms, const glm::mat4& viewProj, int frames, double movesPerSecond)
+{
+    // frames before these are timed let the driver finish setting up
+    const int WARMUP_FRAMES = 60;
+    glfwSwapInterval(0);
+
+    // turns play as if every frame took a sixtieth of a second, so each frame shows the same amount of work however fast it is drawn
+    CubeState cube;
+    CubeRenderer renderer;
+    cube.observer = &renderer;
+    MoveScheduler scheduler(movesPerSecond);
+    vector <double> frameTimes;
+    double uploadTime = 0.0;
+    double drawTime = 0.0;
+    chrono::steady_clock::time_point frameStart = chrono::steady_clock::now();
+    for (int i = 0; i < WARMUP_FRAMES + frames; i++)
     {
-        // D2 move
-        if (glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
-        {
-            turnDFace(2, pieces, edgeStickers, cornerStickers, rotation);
-        }
-        // D' move
-        else if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
+        if (scheduler.isIdle())
         {
-            turnDFace(3, pieces, edgeStickers, cornerStickers, rotation);
+            scheduler.push(randomGenerator.below(NUM_MOVES));
         }
-        // D move
-        else
+        scheduler.update(cube, 1.0 / 60.0);
+
+        // time uniform upload and draw submission on the CPU, and the whole frame from one swap to the next
+        chrono::steady_clock::time_point uploadStart = chrono::steady_clock::now();
+        bool drawBody = uploadCubes(mesh, uniforms, viewProj, renderer, scheduler.getTurnProgress());
+        chrono::steady_clock::time_point drawStart = chrono::steady_clock::now();
+        drawCubes(mesh, drawBody);
+        chrono::steady_clock::time_point drawEnd = chrono::steady_clock::now();
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+        chrono::steady_clock::time_point frameEnd = chrono::steady_clock::now();
+        if (i >= WARMUP_FRAMES)
         {
-            turnDFace(1, pieces, edgeStickers, cornerStickers, rotation);
+            uploadTime += chrono::duration<double>(drawStart - uploadStart).count();
+            drawTime += chrono::duration<double>(drawEnd - drawStart).count();
+            frameTimes.push_back(chrono::duration<double>(frameEnd - frameStart).count());
         }
-        delay(0.2);
+        frameStart = frameEnd;
     }
-    // turn L face
-    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
+
+    // display results
+    double totalTime = 0.0;
+    for (int i = 0; i < frames; i++)
     {
-        // L2 move
-        if (glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
-        {
-            turnLFace(2, pieces, edgeStickers, cornerStickers, rotation);
-        }
-        // L' move
-        else if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
-        {
-            turnLFace(3, pieces, edgeStickers, cornerStickers, rotation);
-        }
-        // L move
-        else
-        {
-            turnLFace(1, pieces, edgeStickers, cornerStickers, rotation);
-        }
-        delay(0.2);
+        totalTime += frameTimes[i];
     }
-    // turn R face
-    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
+    sort(frameTimes.begin(), frameTimes.end());
+    cout << "bench-render frames=" << frames
+         << " mean_ms=" << 1000.0 * totalTime / frames
+         << " p50_ms=" << 1000.0 * percentile(frameTimes, 0.5)
+         << " p99_ms=" << 1000.0 * percentile(frameTimes, 0.99)
+         << " max_ms=" << 1000.0 * frameTimes.back()
+         << " upload_cpu_ms=" << 1000.0 * uploadTime / frames
+         << " draw_cpu_ms=" << 1000.0 * drawTime / frames
+         << " fps=" << frames / totalTime << endl;
+}
+
+// declare longest time the main loop sleeps while waiting for events when nothing is moving
+const double IDLE_WAIT_TIME = 1.0;
+
+int main(int argc, char* argv[])
+{
+    // generate move tables
+    initMoveTables();
+    initRotationTables();
+    initPackedMoves();
+
+    // read command line options
+    string benchmark = "";
+    int benchFrames = 2000;
+    unsigned long long seed = time(NULL);
+    double movesPerSecond = 5.0;
+    bool showFrameTimes = false;
+    string profilePath = "";
+    bool convert = false;
+    string geometryPath = "";
+    string headlessBackend = "";
+    string framesPath = "";
+    string recordPath = "";
+    int frameWidth = 640;
+    int frameHeight = 480;
+    double frameRate = 30.0;
+    for (int i = 1; i < argc; i++)
     {
-        // R2 move
-        if (glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
+        string option = argv[i];
+        if (option == "--bench-moves" || option == "--bench-batch" || option == "--bench-solve" || option == "--bench-scramble" || option == "--bench-render")
         {
-            turnRFace(2, pieces, edgeStickers, cornerStickers, rotation);
+            benchmark = option;
         }
-        // R' move
-        else if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
+        else if (option == "--seed" && i + 1 < argc)
         {
-            turnRFace(3, pieces, edgeStickers, cornerStickers, rotation);
+            seed = strtoull(argv[++i], NULL, 10);
         }
-        // R move
-        else
+        else if (option == "--bench-frames" && i + 1 < argc)
         {
-            turnRFace(1, pieces, edgeStickers, cornerStickers, rotation);
+            benchFrames = max(atoi(argv[++i]), 1);
         }
-        delay(0.2);
-    }
-    // turn F face
-    if (glfwGetKey(window, GLFW_KEY_E) == GLFW_PRESS)
-    {
-        // F2 move
-        if (glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
+        else if (option == "--solver" && i + 1 < argc)
         {
-            turnFFace(2, pieces, edgeStickers, cornerStickers, rotation);
+            string name = argv[++i];
+            if (name == "old-pochmann")
+            {
+                solver = OLD_POCHMANN;
+            }
+            else if (name == "two-phase")
+            {
+                solver = TWO_PHASE;
+            }
+            else if (name == "optimal")
+            {
+                solver = OPTIMAL;
+            }
+            else if (name == "thistlethwaite")
+            {
+                solver = THISTLETHWAITE;
+            }
+            else
+            {
+                cout << "ERROR::OPTIONS::UNKNOWN_SOLVER" << endl;
+            }
         }
-        // F' move
-        else if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
+        else if (option == "--solve-length" && i + 1 < argc)
         {
-            turnFFace(3, pieces, edgeStickers, cornerStickers, rotation);
+            twoPhaseTargetLength = atoi(argv[++i]);
         }
-        // F move
-        else
+        else if (option == "--solve-time" && i + 1 < argc)
         {
-            turnFFace(1, pieces, edgeStickers, cornerStickers, rotation);
+            twoPhaseTimeLimit = atof(argv[++i]);
         }
-        delay(0.2);
-    }
-    // turn B face
-    if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)
-    {
-        // B2 move
-        if (glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
+        else if (option == "--moves-per-second" && i + 1 < argc)
         {
-            turnBFace(2, pieces, edgeStickers, cornerStickers, rotation);
+            movesPerSecond = max(atof(argv[++i]), 0.1);
         }
-        // B' move
-        else if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
+        else if (option == "--frame-times")
         {
-            turnBFace(3, pieces, edgeStickers, cornerStickers, rotation);
+            showFrameTimes = true;
         }
-        // B move
-        else
+        else if (option == "--profile")
         {
-            turnBFace(1, pieces, edgeStickers, cornerStickers, rotation);
+            profilePath = "profile.log";
         }
-        delay(0.2);
-    }
-    // turn M slice
-    if (glfwGetKey(window, GLFW_KEY_Z) == GLFW_PRESS)
-    {
-        // M2 move
-        if (glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
+        else if (option == "--profile-log" && i + 1 < argc)
         {
-            turnMSlice(2, pieces, edgeStickers, cornerStickers, rotation);
+            profilePath = argv[++i];
         }
-        // M' move
-        else if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
+        else if (option == "--convert-vertices")
         {
-            turnMSlice(3, pieces, edgeStickers, cornerStickers, rotation);
+            convert = true;
         }
-        // M move
-        else
+        else if (option == "--geometry" && i + 1 < argc)
         {
-            turnMSlice(1, pieces, edgeStickers, cornerStickers, rotation);
+            geometryPath = argv[++i];
         }
-        delay(0.2);
-    }
-    // turn E slice
-    if (glfwGetKey(window, GLFW_KEY_X) == GLFW_PRESS)
-    {
-        // E2 move
-        if (glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
+        else if (option == "--headless" && i + 1 < argc)
         {
-            turnESlice(2, pieces, edgeStickers, cornerStickers, rotation);
+            headlessBackend = argv[++i];
+            if (headlessBackend != "egl" && headlessBackend != "osmesa")
+            {
+                cout << "ERROR::OPTIONS::UNKNOWN_HEADLESS_BACKEND" << endl;
+                headlessBackend = "";
+            }
         }
-        // E' move
-        else if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
+        else if (option == "--render-solve" && i + 1 < argc)
         {
-            turnESlice(3, pieces, edgeStickers, cornerStickers, rotation);
+            framesPath = argv[++i];
         }
-        // E move
-        else
+        else if (option == "--record" && i + 1 < argc)
         {
-            turnESlice(1, pieces, edgeStickers, cornerStickers, rotation);
+            recordPath = argv[++i];
         }
-        delay(0.2);
-    }
-    // turn S slice
-    if (glfwGetKey(window, GLFW_KEY_C) == GLFW_PRESS)
-    {
-        // S2 move
-        if (glfwGetKey(window, GLFW_KEY_LEFT_CONTROL) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_CONTROL) == GLFW_PRESS)
+        else if (option == "--frame-size" && i + 1 < argc)
         {
-            turnSSlice(2, pieces, edgeStickers, cornerStickers, rotation);
+            if (sscanf(argv[++i], "%dx%d", &frameWidth, &frameHeight) != 2 || frameWidth <= 0 || frameHeight <= 0)
+            {
+                cout << "ERROR::OPTIONS::FRAME_SIZE_NOT_VALID" << endl;
+                frameWidth = 640;
+                frameHeight = 480;
+            }
         }
-        // S' move
-        else if (glfwGetKey(window, GLFW_KEY_LEFT_SHIFT) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_RIGHT_SHIFT) == GLFW_PRESS)
+        else if (option == "--frame-rate" && i + 1 < argc)
         {
-            turnSSlice(3, pieces, edgeStickers, cornerStickers, rotation);
+            frameRate = max(atof(argv[++i]), 1.0);
         }
-        // S move
         else
         {
-            turnSSlice(1, pieces, edgeStickers, cornerStickers, rotation);
+            cout << "ERROR::OPTIONS::UNKNOWN_OPTION" << endl;
         }
-        delay(0.2);
-    }
-    // rotate cube clockwise about x-axis
-    if (glfwGetKey(window, GLFW_KEY_KP_8) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_8) == GLFW_PRESS)
-    {
-        rotateCubeX(1, pieces, edgeStickers, cornerStickers, rotation);
-        delay(0.2);
-    }
-    // rotate cube counter-clockwise about x-axis
-    if (glfwGetKey(window, GLFW_KEY_KP_2) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_2) == GLFW_PRESS)
-    {
-        rotateCubeX(2, pieces, edgeStickers, cornerStickers, rotation);
-        delay(0.2);
-    }
-    // rotate cube clockwise about y-axis
-    if (glfwGetKey(window, GLFW_KEY_KP_4) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_4) == GLFW_PRESS)
-    {
-        rotateCubeY(1, pieces, edgeStickers, cornerStickers, rotation);
-        delay(0.2);
-    }
-    // rotate cube counter-clockwise about y-axis
-    if (glfwGetKey(window, GLFW_KEY_KP_6) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_6) == GLFW_PRESS)
-    {
-        rotateCubeY(2, pieces, edgeStickers, cornerStickers, rotation);
-        delay(0.2);
-    }
-    // rotate cube clockwise about z-axis
-    if (glfwGetKey(window, GLFW_KEY_KP_9) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_9) == GLFW_PRESS)
-    {
-        rotateCubeZ(1, pieces, edgeStickers, cornerStickers, rotation);
-        delay(0.2);
     }
-    // rotate cube counter-clockwise about z-axis
-    if (glfwGetKey(window, GLFW_KEY_KP_7) == GLFW_PRESS || glfwGetKey(window, GLFW_KEY_7) == GLFW_PRESS)
-    {
-        rotateCubeZ(2, pieces, edgeStickers, cornerStickers, rotation);
-        delay(0.2);
-    }
-    // solve cube
-    if (glfwGetKey(window, GLFW_KEY_ENTER) == GLFW_PRESS)
-    {
-        solveCube(window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
-        delay(0.2);
-    }
-    // randomly scramble cube
-    if (glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS)
-    {
-        scrambleCube(pieces, edgeStickers, cornerStickers, rotation);
-        delay(0.2);
-    }
-}
-
-// load vertices from file
-vector < vector <glm::vec3> > loadVertices(string keyword)
-{
-    // declare variables
-    ifstream file;
-    vector < vector <glm::vec3> > vertices;
-    vector <glm::vec3> tempVect;
-    string line;
-    stringstream ss;
-    float x;
-    float y;
-    float z;
-    int component;
 
-    // open file
-    file.open("vertices.txt");
-
-    // find keyword
-    while (line.find(keyword) == string::npos)
-    {
-        getline(file, line);
-    }
+    // seed random number generators, the main thread's is the first to be made so it starts from the seed itself
+    randomSeed = seed;
+    randomGenerator.seed(seed);
 
-    // push vertices from file to vector
-    for (int i = 0; i < 6; i++)
+    // generate tables of the thistlethwaite solver now, so their memory is reported at startup
+    if (solver == THISTLETHWAITE)
     {
-        // get vertices for each square on a cube
-        for (int j = 0; j < 4; j++)
-        {
-            component = 0;
-            getline(file, line);
-            // determine x, y, and z components of vertex
-            for (int k = 0; k < line.length(); k++)
-            {
-                if (line[k] == ' ')
-                {
-                    component++;
-                    if (component == 1)
-                    {
-                        ss >> x;
-                        ss.str("");
-                    }
-                    else if (component == 2)
-                    {
-                        ss >> y;
-                        ss.str("");
-                    }
-                    else if (component == 3)
-                    {
-                        ss >> z;
-                        ss.str("");
-                    }
-                }
-                else
-                {
-                    ss << line[k];
-                }
-            }
-            tempVect.push_back(glm::vec3(x, y, z));
-        }
-        vertices.push_back(tempVect);
-        tempVect.clear();
+        initThistlethwaiteTables();
     }
 
-    return vertices;
-}
-
-// load shaders
-bool loadShaders(GLuint& program)
-{
-    // declare variables
-    bool loadSuccess = true;
-    char infoLog[512];
-    GLint success;
-    string temp = "";
-    string src = "";
-    ifstream in_file;
-
-    // load vertex shader
-    in_file.open("vertex_core.glsl");
-    if (in_file.is_open())
-    {
-        while (getline(in_file, temp))
-        {
-            src += temp + "\n";
-        }
-    }
-    else
+    // run benchmarks and conversions without a window if asked to
+    if (convert)
     {
-        loadSuccess = false;
-        cout << "ERROR::LOADSHADERS::COULD_NOT_OPEN_VERTEX_FILE" << endl;
+        convertVertices();
+        return 0;
     }
-    in_file.close();
-
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    const GLchar* vertSrc = src.c_str();
-    glShaderSource(vertexShader, 1, &vertSrc, NULL);
-    glCompileShader(vertexShader);
-
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (success == false)
+    if (benchmark == "--bench-moves")
     {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        loadSuccess = false;
-        cout << "ERROR::LOADSHADERS::COULD_NOT_COMPILE_VERTEX_FILE" << endl;
-        cout << infoLog << endl;
+        benchmarkMoves();
+        return 0;
     }
-    temp = "";
-    src = "";
-
-    // load fragment shader
-    in_file.open("fragment_core.glsl");
-
-    if (in_file.is_open())
+    if (benchmark == "--bench-batch")
     {
-        while (getline(in_file, temp))
-        {
-            src += temp + "\n";
-        }
+        benchmarkBatch();
+        return 0;
     }
-    else
+    if (benchmark == "--bench-solve")
     {
-        loadSuccess = false;
-        cout << "ERROR::LOADSHADERS::COULD_NOT_OPEN_FRAGMENT_FILE" << endl;
+        benchmarkSolve();
+        return 0;
     }
-    in_file.close();
-
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    const GLchar* fragSrc = src.c_str();
-    glShaderSource(fragmentShader, 1, &fragSrc, NULL);
-    glCompileShader(fragmentShader);
-
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (success == false)
+    if (benchmark == "--bench-scramble")
     {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        loadSuccess = false;
-        cout << "ERROR::LOADSHADERS::COULD_NOT_COMPILE_FRAGMENT_FILE" << endl;
-        cout << infoLog << endl;
+        benchmarkScramble();
+        return 0;
     }
 
-    // create program and attach shaders
-    program = glCreateProgram();
-
-    glAttachShader(program, vertexShader);
-    glAttachShader(program, fragmentShader);
-
-    glLinkProgram(program);
-
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
-    if (success == false)
+    // without a display, use the platform of GLFW that needs none when this version of GLFW has it
+#ifdef GLFW_PLATFORM_NULL
+    if (headlessBackend != "")
     {
-        glGetShaderInfoLog(program, 512, NULL, infoLog);
-        loadSuccess = false;
-        cout << "ERROR::LOADSHADERS::COULD_NOT_LINK_PROGRAM" << endl;
-        cout << infoLog << endl;
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
     }
+#endif
 
-    // end
-    glUseProgram(0);
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    return loadSuccess;
-}
-
-int main()
-{
     // initialize GLFW
     glfwInit();
 
-    // seed random number generator
-    srand(time(NULL));
-
     // create window
     const int WINDOW_WIDTH = 640;
     const int WINDOW_HEIGHT = 480;
@@ -3546,72 +5170,75 @@ int main()
     // determine whether window is resizable or not
     glfwWindowHint(GLFW_RESIZABLE, GL_FALSE);
 
+    // frames are drawn offscreen, so the window is only needed for its context and is never shown
+    // the headless backends make the context with EGL or with OSMesa, which renders in software without a GPU
+    if (framesPath != "")
+    {
+        glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+    }
+    if (headlessBackend == "egl")
+    {
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+    }
+    else if (headlessBackend == "osmesa")
+    {
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    }
+
     // create window
     GLFWwindow* window = glfwCreateWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Rubik's Cube Solver", NULL, NULL);
+    if (window == NULL)
+    {
+        cout << "ERROR::GLFW::COULD_NOT_CREATE_WINDOW" << endl;
+        glfwTerminate();
+        return -1;
+    }
 
     // make context current
     glfwMakeContextCurrent(window);
 
+    // wait for vertical sync when swapping buffers, so animation runs once per displayed frame
+    int swapInterval = 1;
+    glfwSwapInterval(swapInterval);
+
     // enable openGL to test for depth
     glEnable(GL_DEPTH_TEST);
 
     // initialize GLEW
     glewInit();
 
-    // declare vertices
-    // vertices of centre pieces
-    vector < vector <glm::vec3> > UCentreVertices = loadVertices("UCentre");
-    vector < vector <glm::vec3> > DCentreVertices = loadVertices("DCentre");
-    vector < vector <glm::vec3> > LCentreVertices = loadVertices("LCentre");
-    vector < vector <glm::vec3> > RCentreVertices = loadVertices("RCentre");
-    vector < vector <glm::vec3> > FCentreVertices = loadVertices("FCentre");
-    vector < vector <glm::vec3> > BCentreVertices = loadVertices("BCentre");
-    // vertices of edge pieces on M slice
-    vector < vector <glm::vec3> > UFEdgeVertices = loadVertices("UFEdge");
-    vector < vector <glm::vec3> > DFEdgeVertices = loadVertices("DFEdge");
-    vector < vector <glm::vec3> > UBEdgeVertices = loadVertices("UBEdge");
-    vector < vector <glm::vec3> > DBEdgeVertices = loadVertices("DBEdge");
-    // vertices of edge pieces on E slice
-    vector < vector <glm::vec3> > LFEdgeVertices = loadVertices("LFEdge");
-    vector < vector <glm::vec3> > RFEdgeVertices = loadVertices("RFEdge");
-    vector < vector <glm::vec3> > LBEdgeVertices = loadVertices("LBEdge");
-    vector < vector <glm::vec3> > RBEdgeVertices = loadVertices("RBEdge");
-    // vertices of edge pieces on S slice
-    vector < vector <glm::vec3> > LUEdgeVertices = loadVertices("LUEdge");
-    vector < vector <glm::vec3> > RUEdgeVertices = loadVertices("RUEdge");
-    vector < vector <glm::vec3> > LDEdgeVertices = loadVertices("LDEdge");
-    vector < vector <glm::vec3> > RDEdgeVertices = loadVertices("RDEdge");
-    // vertices of corner pieces on U face
-    vector < vector <glm::vec3> > LUFCornerVertices = loadVertices("LUFCorner");
-    vector < vector <glm::vec3> > RUFCornerVertices = loadVertices("RUFCorner");
-    vector < vector <glm::vec3> > LUBCornerVertices = loadVertices("LUBCorner");
-    vector < vector <glm::vec3> > RUBCornerVertices = loadVertices("RUBCorner");
-    // vertices of corner pieces on D face
-    vector < vector <glm::vec3> > LDFCornerVertices = loadVertices("LDFCorner");
-    vector < vector <glm::vec3> > RDFCornerVertices = loadVertices("RDFCorner");
-    vector < vector <glm::vec3> > LDBCornerVertices = loadVertices("LDBCorner");
-    vector < vector <glm::vec3> > RDBCornerVertices = loadVertices("RDBCorner");
-
-    // declare array for positions of pieces of cube
-    int pieces[26] =
-    {
-        0, 1, 2, 3, 4, 5, // centre pieces
-        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, // edge pieces
-        18, 19, 20, 21, 22, 23, 24, 25 // corner pieces
-    };
-
-    // declare arrays for positions of stickers of cube
-    int edgeStickers[24] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23 }; // edge stickers
-    int cornerStickers[24] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23 }; // corner stickers
-
-    // declare array for rotation of pieces of cube
-    glm::mat4 rotation[26];
-    for (int i = 0; i < 26; i++)
+    // generate vertices of each piece, or load them from a geometry file if one is given
+    chrono::steady_clock::time_point loadStart = chrono::steady_clock::now();
+    vector < vector < vector <glm::vec3> > > pieceVertices(26);
+    if (geometryPath == "")
     {
-        rotation[i] = glm::mat4(1.0);
-        rotation[i] = YAxisRotation(rotation[i], 32.0);
-        rotation[i] = XAxisRotation(rotation[i], -22.0);
+        generateCubeVertices(PIECE_SIZE, pieceVertices);
+        cout << "Generated geometry in ";
+    }
+    else
+    {
+        bool binary = geometryPath.size() >= 4 && geometryPath.compare(geometryPath.size() - 4, 4, ".bin") == 0;
+        if (!(binary ? loadVerticesBinary(geometryPath, pieceVertices.data()) : loadVerticesText(geometryPath, pieceVertices.data())))
+        {
+            glfwTerminate();
+            return -1;
+        }
+        cout << "Loaded geometry from " << geometryPath << " in ";
     }
+    cout << chrono::duration<double>(chrono::steady_clock::now() - loadStart).count() * 1000.0 << " ms" << endl;
+
+    // declare state of cube and renderer that follows it
+    CubeState cube;
+    CubeRenderer renderer;
+    cube.observer = &renderer;
+
+    // declare scheduler that plays moves on cube
+    MoveScheduler scheduler(movesPerSecond);
+
+    // queue key presses from callback, and redraw when the window needs it
+    glfwSetKeyCallback(window, keyCallback);
+    glfwSetWindowUserPointer(window, &renderer);
+    glfwSetWindowRefreshCallback(window, windowRefreshCallback);
 
     // create and load shaders
     GLuint core_program;
@@ -3619,13 +5246,16 @@ int main()
     {
         glfwTerminate();
     }
+    ShaderUniforms uniforms = getShaderUniforms(core_program);
 
     // create projection matrix
     float fov = 90.0f;
     float nearPlane = 0.1f;
     float farPlane = 100.0f;
     glm::mat4 proj = glm::mat4(1.0f);
-    proj = glm::perspective(glm::radians(fov), 640.0f / 480.0f, nearPlane, farPlane);
+    proj = glm::perspective(glm::radians(fov), (float)WINDOW_WIDTH / WINDOW_HEIGHT, nearPlane, farPlane);
+    // written frames can have a different shape to the window
+    glm::mat4 frameProj = glm::perspective(glm::radians(fov), (float)frameWidth / frameHeight, nearPlane, farPlane);
 
     // create view matrix
     glm::vec3 camPosition = glm::vec3(0.0f, 0.0f, 1.5f);
@@ -3633,37 +5263,50 @@ int main()
     glm::vec3 camFront = glm::vec3(0.0f, 0.0f, -1.0f);
     glm::mat4 view = glm::mat4(1.0f);
     view = glm::lookAt(camPosition, camPosition + camFront, worldUp);
+    // tilt cube towards camera
+    view = view * XAxisRotation(YAxisRotation(glm::mat4(1.0f), 32.0f), -22.0f);
 
-    // create cubes
-    Cube cubes[26] =
-    {
-        Cube(UCentreVertices),
-        Cube(LCentreVertices),
-        Cube(FCentreVertices),
-        Cube(RCentreVertices),
-        Cube(BCentreVertices),
-        Cube(DCentreVertices),
-        Cube(UFEdgeVertices),
-        Cube(UBEdgeVertices),
-        Cube(DBEdgeVertices),
-        Cube(DFEdgeVertices),
-        Cube(LFEdgeVertices),
-        Cube(RFEdgeVertices),
-        Cube(RBEdgeVertices),
-        Cube(LBEdgeVertices),
-        Cube(LUEdgeVertices),
-        Cube(RUEdgeVertices),
-        Cube(RDEdgeVertices),
-        Cube(LDEdgeVertices),
-        Cube(LUBCornerVertices),
-        Cube(RUBCornerVertices),
-        Cube(RUFCornerVertices),
-        Cube(LUFCornerVertices),
-        Cube(LDBCornerVertices),
-        Cube(RDBCornerVertices),
-        Cube(RDFCornerVertices),
-        Cube(LDFCornerVertices)
-    };
+    // the camera never moves, so view and projection are combined once
+    glm::mat4 viewProj = proj * view;
+    glm::mat4 frameViewProj = frameProj * view;
+
+    // create mesh of every piece
+    CubeMesh mesh(pieceVertices.data(), 26);
+
+    // measure how fast frames are drawn instead of showing the cube if asked to
+    if (benchmark == "--bench-render")
+    {
+        glUseProgram(core_program);
+        benchmarkRender(window, mesh, uniforms, viewProj, benchFrames, movesPerSecond);
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return 0;
+    }
+
+    // write frames of a solve instead of opening the window if asked to
+    if (framesPath != "")
+    {
+        glUseProgram(core_program);
+        renderSolveFrames(mesh, uniforms, frameViewProj, framesPath, frameWidth, frameHeight, frameRate, movesPerSecond);
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return 0;
+    }
+
+    // record each solve to a file if asked to
+    SolveRecorder* recorder = NULL;
+    if (recordPath != "")
+    {
+        glUseProgram(core_program);
+        recorder = new SolveRecorder(mesh, uniforms, renderer, frameViewProj, recordPath, frameWidth, frameHeight, frameRate, movesPerSecond);
+    }
+
+    // profile each frame if asked to
+    FrameProfiler* profiler = NULL;
+    if (profilePath != "")
+    {
+        profiler = new FrameProfiler(window, profilePath);
+    }
 
     // display instructions
     cout << "INSTRUCTIONS" << endl;
@@ -3692,22 +5335,92 @@ int main()
     cout << "--------------" << endl;
 
     // main program loop
+    FrameTimer frameTimer;
+    double lastFrameTime = glfwGetTime();
     while (!glfwWindowShouldClose(window))
     {
-        // poll for events
-        glfwPollEvents();
+        // poll for events while moves are playing, otherwise sleep until something happens so an idle cube uses no CPU
+        // keys queued while a solve or scramble waited for moves to finish, and frames that need drawing, don't wait
+        bool animating = !scheduler.isIdle();
+        if (animating || !keyEvents.empty() || renderer.dirty)
+        {
+            glfwPollEvents();
+        }
+        else
+        {
+            glfwWaitEventsTimeout(IDLE_WAIT_TIME);
+        }
+
+        // find time since last frame, time spent waiting while idle would only make the next moves play at once
+        double currentTime = glfwGetTime();
+        double deltaTime = animating ? currentTime - lastFrameTime : 0.0;
+        lastFrameTime = currentTime;
+
+        // time each stage of the frame for the profiler
+        double stageTimes[NUM_PROFILE_STAGES] = {};
 
         // update input
-        updateInput(window, pieces, edgeStickers, cornerStickers, rotation, cubes, core_program, proj, view);
+        {
+            ScopedTimer timer(stageTimes[INPUT_STAGE]);
+            updateInput(cube, scheduler, recorder);
+        }
 
-        // use program
-        glUseProgram(core_program);
+        // make moves that are due
+        {
+            ScopedTimer timer(stageTimes[UPDATE_STAGE]);
+            scheduler.update(cube, deltaTime);
+        }
+
+        // draw only when the cube has changed, a turn is part way, or the window needs it
+        // the frame that finishes an animation is still drawn, since the scheduler was busy at the start of it
+        if (!animating && !renderer.dirty)
+        {
+            continue;
+        }
+        renderer.dirty = false;
+
+        // keep vertical sync during animation so it is smooth, and present single redraws straight away
+        if (swapInterval != (animating ? 1 : 0))
+        {
+            swapInterval = animating ? 1 : 0;
+            glfwSwapInterval(swapInterval);
+        }
+
+        // use program and render cubes
+        {
+            ScopedTimer timer(stageTimes[RENDER_STAGE]);
+            glUseProgram(core_program);
+            if (profiler != NULL)
+            {
+                profiler->beginGpu();
+            }
+            renderCubes(mesh, uniforms, viewProj, renderer, scheduler.getTurnProgress());
+            if (profiler != NULL)
+            {
+                profiler->endGpu();
+            }
+        }
+
+        // time work done on the CPU this frame, before waiting for the buffers to swap
+        if (showFrameTimes)
+        {
+            frameTimer.addFrame(glfwGetTime() - currentTime, currentTime);
+        }
 
-        // render cubes
-        renderCubes(window, cubes, core_program, proj, view, rotation);
+        // swap buffers
+        {
+            ScopedTimer timer(stageTimes[SWAP_STAGE]);
+            glfwSwapBuffers(window);
+        }
+        if (profiler != NULL)
+        {
+            profiler->addFrame(stageTimes, currentTime);
+        }
     }
 
     // end program
+    delete profiler;
+    delete recorder;
     glfwDestroyWindow(window);
     glfwTerminate();
 